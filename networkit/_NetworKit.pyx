@@ -1299,6 +1299,37 @@ cdef class BFS(SSSP):
 		self._G = G
 		self._this = new _BFS(G._this, source, storePaths, storeStack, target)
 
+cdef extern from "cpp/graph/DirOptBFS.h":
+	cdef cppclass _DirOptBFS "NetworKit::DirOptBFS"(_SSSP):
+		_DirOptBFS(_Graph G, node source, bool storePaths, bool storeStack, node target) except +
+
+cdef class DirOptBFS(SSSP):
+	""" Parallel direction-optimizing breadth-first search on a Graph from a given source.
+	Expands the frontier top-down while it is small and switches to bottom-up steps,
+	in which unvisited nodes look for a parent in the frontier, once it is large.
+
+	DirOptBFS(G, source, [storePaths], [storeStack], target)
+
+	Create DirOptBFS for `G` and source node `source`.
+
+	Parameters
+	----------
+	G : Graph
+		The graph.
+	source : node
+		The source node of the breadth-first search.
+	storePaths : bool
+		store paths and number of paths?
+	storeStack : bool
+		maintain a stack of nodes in order of decreasing distance?
+	target: node
+		terminate search when the level of the target has been reached
+	"""
+
+	def __cinit__(self, Graph G, source, storePaths=True, storeStack=False, target=none):
+		self._G = G
+		self._this = new _DirOptBFS(G._this, source, storePaths, storeStack, target)
+
 cdef extern from "cpp/graph/DynBFS.h":
 	cdef cppclass _DynBFS "NetworKit::DynBFS"(_DynSSSP):
 		_DynBFS(_Graph G, node source) except +
@@ -1354,6 +1385,40 @@ cdef class Dijkstra(SSSP):
 		self._G = G
 		self._this = new _Dijkstra(G._this, source, storePaths, storeStack, target)
 
+cdef extern from "cpp/graph/DeltaStepping.h":
+	cdef cppclass _DeltaStepping "NetworKit::DeltaStepping"(_SSSP):
+		_DeltaStepping(_Graph G, node source, bool storePaths, bool storeStack, node target, edgeweight delta) except +
+		edgeweight getDelta() except +
+
+cdef class DeltaStepping(SSSP):
+	""" Parallel delta-stepping SSSP algorithm for non-negative edge weights.
+	Computes the same distances as Dijkstra, using all threads.
+
+	DeltaStepping(G, source, [storePaths], [storeStack], target, delta)
+
+	Parameters
+	----------
+	G : Graph
+		The graph.
+	source : node
+		The source node.
+	storePaths : bool
+		store paths and number of paths? Requires positive edge weights.
+	storeStack : bool
+		maintain a stack of nodes in order of decreasing distance? Requires positive edge weights.
+	target : node
+		target node. Search ends once the bucket containing the target has been settled.
+	delta : double
+		bucket width; 0 chooses the maximum edge weight divided by the average degree
+	"""
+	def __cinit__(self, Graph G, source, storePaths=True, storeStack=False, node target=none, edgeweight delta=0):
+		self._G = G
+		self._this = new _DeltaStepping(G._this, source, storePaths, storeStack, target, delta)
+
+	def getDelta(self):
+		""" Returns the bucket width used by the last run. """
+		return (<_DeltaStepping*>(self._this)).getDelta()
+
 cdef extern from "cpp/graph/DynDijkstra.h":
 	cdef cppclass _DynDijkstra "NetworKit::DynDijkstra"(_DynSSSP):
 		_DynDijkstra(_Graph G, node source) except +
@@ -1466,6 +1531,67 @@ cdef class SpanningForest:
 	def generate(self):
 		return Graph().setThis(self._this.generate());
 
+cdef extern from "cpp/graph/BoruvkaMSF.h":
+	cdef cppclass _BoruvkaMSF "NetworKit::BoruvkaMSF"(_Algorithm):
+		_BoruvkaMSF(_Graph, bool maximum, bool randomTies) except +
+		_BoruvkaMSF(_Graph, vector[double], bool maximum, bool randomTies) except +
+		vector[edgeid] forestEdgeIds() except +
+		double totalWeight() except +
+		_Graph getForest() except +
+
+cdef class BoruvkaMSF(Algorithm):
+	"""
+	Computes a minimum- or maximum-weight spanning forest with a parallel version of Boruvka's algorithm,
+	without sorting the edges.
+
+	Parameters
+	----------
+	G : Graph
+		The undirected input graph.
+	attribute : list
+		If given, this edge attribute is used instead of the edge weights. The graph needs edge ids.
+	maximum : bool
+		Compute a maximum-weight instead of a minimum-weight spanning forest.
+	randomTies : bool
+		Break ties between edges of equal weight by a random order drawn anew in each run.
+	"""
+	cdef Graph _G
+
+	def __cinit__(self, Graph G not None, vector[double] attribute = vector[double](), maximum = False, randomTies = False):
+		self._G = G
+
+		if attribute.empty():
+			self._this = new _BoruvkaMSF(G._this, maximum, randomTies)
+		else:
+			self._this = new _BoruvkaMSF(G._this, attribute, maximum, randomTies)
+
+	def getForest(self):
+		"""
+		Returns
+		-------
+		Graph
+			The spanning forest as a graph on the nodes of G.
+		"""
+		return Graph().setThis((<_BoruvkaMSF*>(self._this)).getForest())
+
+	def forestEdgeIds(self):
+		"""
+		Returns
+		-------
+		list
+			The ids of the forest edges, only available if the graph has edge ids.
+		"""
+		return (<_BoruvkaMSF*>(self._this)).forestEdgeIds()
+
+	def totalWeight(self):
+		"""
+		Returns
+		-------
+		float
+			The sum of the weights (or attribute values) of the forest edges.
+		"""
+		return (<_BoruvkaMSF*>(self._this)).totalWeight()
+
 cdef extern from "cpp/graph/UnionMaximumSpanningForest.h":
 	cdef cppclass _UnionMaximumSpanningForest "NetworKit::UnionMaximumSpanningForest"(_Algorithm):
 		_UnionMaximumSpanningForest(_Graph) except +
@@ -1563,7 +1689,7 @@ cdef extern from "cpp/graph/RandomMaximumSpanningForest.h":
 
 cdef class RandomMaximumSpanningForest(Algorithm):
 	"""
-	Computes a random maximum-weight spanning forest using Kruskal's algorithm by randomizing the order of edges of the same weight.
+	Computes a random maximum-weight spanning forest with a parallel version of Boruvka's algorithm by randomizing the order of edges of the same weight.
 
 	Parameters
 	----------
@@ -2844,7 +2970,7 @@ cdef class GraphToolBinaryReader(GraphReader):
 cdef extern from "cpp/io/EdgeListReader.h":
 	cdef cppclass _EdgeListReader "NetworKit::EdgeListReader"(_GraphReader):
 		_EdgeListReader() except +
-		_EdgeListReader(char separator, node firstNode, string commentPrefix, bool continuous, bool directed)
+		_EdgeListReader(char separator, node firstNode, string commentPrefix, bool continuous, bool directed, bool parallel)
 		map[string,node] getNodeMap() except +
 
 
@@ -2852,8 +2978,8 @@ cdef class EdgeListReader(GraphReader):
 	""" Reads a file in an edge list format.
 		TODO: docstring
 	"""
-	def __cinit__(self, separator, firstNode, commentPrefix="#", continuous=True, directed=False):
-		self._this = new _EdgeListReader(stdstring(separator)[0], firstNode, stdstring(commentPrefix), continuous, directed)
+	def __cinit__(self, separator, firstNode, commentPrefix="#", continuous=True, directed=False, parallel=False):
+		self._this = new _EdgeListReader(stdstring(separator)[0], firstNode, stdstring(commentPrefix), continuous, directed, parallel)
 
 	def getNodeMap(self):
 		cdef map[string,node] cResult = (<_EdgeListReader*>(self._this)).getNodeMap()
@@ -4124,6 +4250,7 @@ cdef extern from "cpp/community/PLP.h":
 		_PLP(_Graph _G, _Partition baseClustering, count updateThreshold) except +
 		count numberOfIterations() except +
 		vector[count] getTiming() except +
+		vector[count] getActiveSetSizes() except +
 
 
 cdef class PLP(CommunityDetector):
@@ -4182,6 +4309,16 @@ cdef class PLP(CommunityDetector):
 		"""
 		return (<_PLP*>(self._this)).getTiming()
 
+	def getActiveSetSizes(self):
+		""" Get the number of active nodes for each iteration.
+
+		Returns
+		-------
+		count
+			The list of active set sizes.
+		"""
+		return (<_PLP*>(self._this)).getActiveSetSizes()
+
 cdef extern from "cpp/community/LPDegreeOrdered.h":
 	cdef cppclass _LPDegreeOrdered "NetworKit::LPDegreeOrdered"(_CommunityDetectionAlgorithm):
 		_LPDegreeOrdered(_Graph _G) except +
@@ -4237,7 +4374,7 @@ cdef class PLM(CommunityDetector):
 		maxIter : count
 			maximum number of iterations for move phase
 		turbo : bool, optional
-			faster but uses O(n) additional memory per thread
+			ignored, kept for compatibility. The affinities are always accumulated densely, which uses O(n) additional memory per thread
 		recurse: bool, optional
 			use recursive coarsening, see http://journals.aps.org/pre/abstract/10.1103/PhysRevE.89.049902 for some explanations (default: true)
 	"""
@@ -4891,6 +5028,120 @@ cdef class EdmondsKarp:
 		"""
 		return self._this.getFlowVector()
 
+cdef extern from "cpp/flow/PushRelabel.h":
+	cdef cppclass _PushRelabel "NetworKit::PushRelabel":
+		_PushRelabel(const _Graph &graph, node source, node sink, bool parallel) except +
+		void run() nogil except +
+		void setTerminals(node source, node sink) except +
+		edgeweight getMaxFlow() const
+		vector[node] getSourceSet() except +
+		edgeweight getFlow(node u, node v) except +
+		edgeweight getFlow(edgeid eid) const
+		vector[edgeweight] getFlowVector() except +
+
+cdef class PushRelabel:
+	"""
+	The PushRelabel class implements the push-relabel maximum flow algorithm by Goldberg and Tarjan with the global
+	relabeling and gap heuristics. It has the same interface as EdmondsKarp. The edges of the graph must be indexed.
+
+	Parameters
+	----------
+	graph : Graph
+		The graph
+	source : node
+		The source node for the flow calculation
+	sink : node
+		The sink node for the flow calculation
+	parallel : bool
+		Use the synchronous parallel variant
+	"""
+	cdef _PushRelabel* _this
+	cdef Graph _graph
+
+	def __cinit__(self, Graph graph not None, node source, node sink, bool parallel = False):
+		self._graph = graph # store reference of graph for memory management, so the graph is not deallocated before this object
+		self._this = new _PushRelabel(graph._this, source, sink, parallel)
+
+	def __dealloc__(self):
+		del self._this
+
+	def run(self):
+		"""
+		Computes the maximum flow, executes the push-relabel algorithm
+		"""
+		with nogil:
+			self._this.run()
+		return self
+
+	def setTerminals(self, node source, node sink):
+		"""
+		Changes the source and the sink for the next run, which then reuses the residual network of the previous one.
+
+		Parameters
+		----------
+		source : node
+			The source node for the flow calculation
+		sink : node
+			The sink node for the flow calculation
+		"""
+		self._this.setTerminals(source, sink)
+		return self
+
+	def getMaxFlow(self):
+		"""
+		Returns the value of the maximum flow from source to sink.
+
+		Returns
+		-------
+		edgeweight
+			The maximum flow value
+		"""
+		return self._this.getMaxFlow()
+
+	def getSourceSet(self):
+		"""
+		Returns the set of the nodes on the source side of the flow/minimum cut.
+
+		Returns
+		-------
+		list
+			The set of nodes that form the (smallest) source side of the flow/minimum cut.
+		"""
+		return self._this.getSourceSet()
+
+	def getFlow(self, node u, node v = none):
+		"""
+		Get the flow value between two nodes u and v or an edge identified by the edge id u.
+		Warning: The variant with two edge ids is linear in the degree of u.
+
+		Parameters
+		----------
+		u : node or edgeid
+			The first node incident to the edge or the edge id
+		v : node
+			The second node incident to the edge (optional if edge id is specified)
+
+		Returns
+		-------
+		edgeweight
+			The flow on the specified edge
+		"""
+		if v == none: # Assume that node and edge ids are the same type
+			return self._this.getFlow(u)
+		else:
+			return self._this.getFlow(u, v)
+
+	def getFlowVector(self):
+		"""
+		Return a copy of the flow values of all edges.
+
+		Returns
+		-------
+		list
+			The flow values of all edges indexed by edge id
+		"""
+		return self._this.getFlowVector()
+
 # Module: properties
 
 cdef extern from "cpp/components/ConnectedComponents.h":
@@ -5001,12 +5252,61 @@ cdef class ParallelConnectedComponents:
 		return self._this.componentOfNode(v)
 
 
+cdef extern from "cpp/components/AfforestConnectedComponents.h":
+	cdef cppclass _AfforestConnectedComponents "NetworKit::AfforestConnectedComponents":
+		_AfforestConnectedComponents(_Graph G) except +
+		void run() nogil except +
+		count numberOfComponents() except +
+		count componentOfNode(node query) except +
+		_Partition getPartition() except +
+		vector[vector[node]] getComponents() except +
+
+
+cdef class AfforestConnectedComponents:
+	""" Determines the connected components of an undirected graph in parallel with a concurrent
+		union-find (Afforest algorithm). The running time does not depend on the diameter of the graph.
+		The components are numbered like in ConnectedComponents.
+
+		Parameters
+		----------
+		G : Graph
+			The graph.
+	"""
+	cdef _AfforestConnectedComponents* _this
+	cdef Graph _G
+
+	def __cinit__(self, Graph G):
+		self._G = G
+		self._this = new _AfforestConnectedComponents(G._this)
+
+	def __dealloc__(self):
+		del self._this
+
+	def run(self):
+		with nogil:
+			self._this.run()
+		return self
+
+	def getPartition(self):
+		return Partition().setThis(self._this.getPartition())
+
+	def numberOfComponents(self):
+		return self._this.numberOfComponents()
+
+	def componentOfNode(self, v):
+		return self._this.componentOfNode(v)
+
+	def getComponents(self):
+		return self._this.getComponents()
+
+
 cdef extern from "cpp/components/StronglyConnectedComponents.h":
 	cdef cppclass _StronglyConnectedComponents "NetworKit::StronglyConnectedComponents":
 		_StronglyConnectedComponents(_Graph G, bool iterativeAlgo) except +
 		void run() nogil except +
 		void runIteratively() nogil except +
 		void runRecursively() nogil except +
+		void runParallel() nogil except +
 		count numberOfComponents() except +
 		count componentOfNode(node query) except +
 		_Partition getPartition() except +
@@ -5051,6 +5351,11 @@ cdef class StronglyConnectedComponents:
 			self._this.runRecursively()
 		return self
 
+	def runParallel(self):
+		with nogil:
+			self._this.runParallel()
+		return self
+
 	def getPartition(self):
 		return Partition().setThis(self._this.getPartition())
 
@@ -5081,6 +5386,8 @@ cdef class ClusteringCoefficient:
 		----------
 		G : Graph
 			The graph.
+		turbo : bool
+			Ignored, kept for compatibility (see centrality.LocalClusteringCoefficient).
 
 		Notes
 		-----
@@ -5159,7 +5466,7 @@ class _DiameterAlgo(object):
 
 cdef extern from "cpp/distance/Diameter.h" namespace "NetworKit::Diameter":
 	cdef cppclass _Diameter "NetworKit::Diameter"(_Algorithm):
-		_Diameter(_Graph G, DiameterAlgo algo, double error, count nSamples) except +
+		_Diameter(_Graph G, DiameterAlgo algo, double error, count nSamples, bool parallelBFS) except +
 		pair[count, count] getDiameter() nogil except +
 
 cdef class Diameter(Algorithm):
@@ -5167,16 +5474,16 @@ cdef class Diameter(Algorithm):
 	"""
 	TODO: docstring
 	"""
-	def __cinit__(self, Graph G not None, algo = _DiameterAlgo.Automatic, error = -1., nSamples = 0):
+	def __cinit__(self, Graph G not None, algo = _DiameterAlgo.Automatic, error = -1., nSamples = 0, parallelBFS = False):
 		self._G = G
-		self._this = new _Diameter(G._this, algo, error, nSamples)
+		self._this = new _Diameter(G._this, algo, error, nSamples, parallelBFS)
 
 	def getDiameter(self):
 		return (<_Diameter*>(self._this)).getDiameter()
 
 
 cdef extern from "cpp/distance/Eccentricity.h" namespace "NetworKit::Eccentricity":
-	pair[node, count] getValue(_Graph G, node v) except +
+	pair[node, count] getValue(_Graph G, node v, bool parallel) except +
 
 cdef class Eccentricity:
 	"""
@@ -5184,8 +5491,8 @@ cdef class Eccentricity:
 	"""
 
 	@staticmethod
-	def getValue(Graph G, v):
-		return getValue(G._this, v)
+	def getValue(Graph G, v, parallel=False):
+		return getValue(G._this, v, parallel)
 
 
 cdef extern from "cpp/distance/EffectiveDiameter.h" namespace "NetworKit::EffectiveDiameter":
@@ -5804,7 +6111,7 @@ cdef extern from "cpp/centrality/ApproxCloseness.h":
 cdef extern from "cpp/centrality/ApproxCloseness.h":
 	cdef cppclass _ApproxCloseness "NetworKit::ApproxCloseness" (_Centrality):
 		_ClosenessType type
-		_ApproxCloseness(_Graph, count, float, bool, _ClosenessType type) except +
+		_ApproxCloseness(_Graph, count, float, bool, _ClosenessType type, bool parallelBFS) except +
 		vector[double] getSquareErrorEstimates() except +
 
 
@@ -5813,7 +6120,7 @@ cdef class ApproxCloseness(Centrality):
 	""" Approximation of closeness centrality according to algorithm described in
   Cohen et al., Computing Classic Closeness Centrality, at Scale.
 
-	ApproxCloseness(G, nSamples, epsilon=0.1, normalized=False, type=OUTBOUND)
+	ApproxCloseness(G, nSamples, epsilon=0.1, normalized=False, type=OUTBOUND, parallelBFS=False)
 
 	The algorithm approximates the closeness of all nodes in both directed and undirected graphs using a hybrid estimator.
 	First, it takes nSamples samples. For these sampled nodes, the closeness is computed exactly. The pivot of each of the
@@ -5832,6 +6139,8 @@ cdef class ApproxCloseness(Centrality):
 		normalize centrality values in interval [0,1]
 	type : _ClosenessType, optional
 		use in- or outbound centrality or the sum of both (see paper) for computing closeness on directed graph. If G is undirected, this can be ignored.
+	parallelBFS : bool, optional
+		on unweighted graphs, use the parallel direction-optimizing BFS to order nodes by their distance to a pivot
 	"""
 
 	#cdef _ApproxCloseness _this
@@ -5839,9 +6148,9 @@ cdef class ApproxCloseness(Centrality):
 	OUTBOUND = 1
 	SUM = 2
 
-	def __cinit__(self, Graph G, nSamples, epsilon=0.1, normalized=False, _ClosenessType type=OUTBOUND):
+	def __cinit__(self, Graph G, nSamples, epsilon=0.1, normalized=False, _ClosenessType type=OUTBOUND, parallelBFS=False):
 		self._G = G
-		self._this = new _ApproxCloseness(G._this, nSamples, epsilon, normalized, type)
+		self._this = new _ApproxCloseness(G._this, nSamples, epsilon, normalized, type, parallelBFS)
 
 	def getSquareErrorEstimates(self):
 		""" Return a vector containing the square error estimates for all nodes.
@@ -5857,12 +6166,12 @@ cdef class ApproxCloseness(Centrality):
 
 cdef extern from "cpp/centrality/PageRank.h":
 	cdef cppclass _PageRank "NetworKit::PageRank" (_Centrality):
-		_PageRank(_Graph, double damp, double tol) except +
+		_PageRank(_Graph, double damp, double tol, bool gaussSeidel) except +
 
 cdef class PageRank(Centrality):
 	"""	Compute PageRank as node centrality measure.
 
-	PageRank(G, damp=0.85, tol=1e-9)
+	PageRank(G, damp=0.85, tol=1e-9, gaussSeidel=False)
 
 	Parameters
 	----------
@@ -5872,11 +6181,71 @@ cdef class PageRank(Centrality):
 		Damping factor of the PageRank algorithm.
 	tol : double, optional
 		Error tolerance for PageRank iteration.
+	gaussSeidel : bool, optional
+		Use Gauss-Seidel sweeps within blocks of nodes instead of Jacobi sweeps.
+	"""
+
+	def __cinit__(self, Graph G, double damp=0.85, double tol=1e-9, bool gaussSeidel=False):
+		self._G = G
+		self._this = new _PageRank(G._this, damp, tol, gaussSeidel)
+
+
+
+cdef extern from "cpp/centrality/PersonalizedPageRank.h":
+	cdef cppclass _PersonalizedPageRank "NetworKit::PersonalizedPageRank" (_Algorithm):
+		_PersonalizedPageRank(_Graph, vector[vector[node]] seeds, double damp, double tol, bool gaussSeidel) except +
+		vector[double] scores(index s) except +
+		double score(index s, node u) except +
+		count numberOfIterations() except +
+
+cdef class PersonalizedPageRank(Algorithm):
+	"""	Computes personalized PageRank for several seed sets at once. The random surfer of each seed set
+	teleports to a uniformly chosen node of the set. All score vectors are computed in the same sweeps over the edges.
+
+	PersonalizedPageRank(G, seeds, damp=0.85, tol=1e-9, gaussSeidel=False)
+
+	Parameters
+	----------
+	G : Graph
+		Graph to be processed.
+	seeds : list of lists of nodes
+		One non-empty seed set per score vector.
+	damp : double
+		Damping factor of the PageRank algorithm.
+	tol : double, optional
+		Error tolerance for each score vector.
+	gaussSeidel : bool, optional
+		Use Gauss-Seidel sweeps within blocks of nodes instead of Jacobi sweeps.
 	"""
+	cdef Graph _G
 
-	def __cinit__(self, Graph G, double damp=0.85, double tol=1e-9):
+	def __cinit__(self, Graph G, seeds, double damp=0.85, double tol=1e-9, bool gaussSeidel=False):
 		self._G = G
-		self._this = new _PageRank(G._this, damp, tol)
+		self._this = new _PersonalizedPageRank(G._this, seeds, damp, tol, gaussSeidel)
+
+	def scores(self, index s):
+		"""
+		Returns the scores of seed set s.
+
+		Returns
+		-------
+		list
+			The personalized PageRank of each node, sums up to 1.
+		"""
+		return (<_PersonalizedPageRank*>(self._this)).scores(s)
+
+	def score(self, index s, node u):
+		"""
+		Returns the score of node u for seed set s. Raises an error if s is not a seed set index or u is
+		not below the upper node id bound.
+		"""
+		return (<_PersonalizedPageRank*>(self._this)).score(s, u)
+
+	def numberOfIterations(self):
+		"""
+		Returns the number of sweeps until all score vectors converged.
+		"""
+		return (<_PersonalizedPageRank*>(self._this)).numberOfIterations()
 
 
 
@@ -5907,8 +6276,9 @@ cdef class EigenvectorCentrality(Centrality):
 
 cdef extern from "cpp/centrality/CoreDecomposition.h":
 	cdef cppclass _CoreDecomposition "NetworKit::CoreDecomposition" (_Centrality):
-		_CoreDecomposition(_Graph, bool, bool) except +
+		_CoreDecomposition(_Graph, bool, bool, bool) except +
 		_Cover getCover() except +
+		vector[node] getNodeOrder() except +
 		_Partition getPartition() except +
 		index maxCoreNumber() except +
 
@@ -5927,11 +6297,24 @@ cdef class CoreDecomposition(Centrality):
 		Divide each core number by the maximum degree.
 	enforceBucketQueueAlgorithm : boolean
 		enforce switch to sequential algorithm
+	storeNodeOrder : boolean
+		store the order in which the nodes are removed, implies the sequential algorithm
 	"""
 
-	def __cinit__(self, Graph G, bool normalized=False, bool enforceBucketQueueAlgorithm=False):
+	def __cinit__(self, Graph G, bool normalized=False, bool enforceBucketQueueAlgorithm=False, bool storeNodeOrder=False):
 		self._G = G
-		self._this = new _CoreDecomposition(G._this, normalized, enforceBucketQueueAlgorithm)
+		self._this = new _CoreDecomposition(G._this, normalized, enforceBucketQueueAlgorithm, storeNodeOrder)
+
+	def getNodeOrder(self):
+		""" Get the nodes in the order in which they were removed (a degeneracy order).
+		Only available if the node order was stored.
+
+		Returns
+		-------
+		list
+			The nodes sorted by removal time.
+		"""
+		return (<_CoreDecomposition*>(self._this)).getNodeOrder()
 
 	def maxCoreNumber(self):
 		""" Get maximum core number.
@@ -5974,11 +6357,7 @@ cdef class LocalClusteringCoefficient(Centrality):
 		Constructs the LocalClusteringCoefficient class for the given Graph `G`. If the local clustering coefficient values should be normalized,
 		then set `normalized` to True. The graph may not contain self-loops.
 
-		There are two algorithms available. The trivial (parallel) algorithm needs only a small amount of additional memory.
-		The turbo mode adds a (sequential, but fast) pre-processing step using ideas from [0]. This reduces the running time
-		significantly for most graphs. However, the turbo mode needs O(m) additional memory. In practice this should be a bit
-		less than half of the memory that is needed for the graph itself. The turbo mode is particularly effective for graphs
-		with nodes of very high degree and a very skewed degree distribution.
+		The triangles are counted by orienting the edges by degree using ideas from [0], which needs O(m) additional memory.
 
 		[0] Triangle Listing Algorithms: Back from the Diversion
 		Mark Ortmann and Ulrik Brandes                                                                          *
@@ -5989,7 +6368,7 @@ cdef class LocalClusteringCoefficient(Centrality):
 	 	G : Graph
 	 		The graph.
 		turbo : bool
-			If the turbo mode shall be activated.
+			Ignored, kept for compatibility. The former turbo mode is now always used.
 	"""
 
 	def __cinit__(self, Graph G, bool turbo = False):
@@ -6694,11 +7073,11 @@ cdef class MaxClique:
 	"""
 	Exact algorithm for computing the size of the largest clique in a graph.
 	Worst-case running time is exponential, but in practice the algorithm is fairly fast.
-	Reference: Pattabiraman et al., http://arxiv.org/pdf/1411.7460.pdf
+	Runs the parallel bitset branch-and-bound of BitsetMaxClique.
 
 	Parameters:
 	-----------
-	G : graph in which the cut is to be produced, must be unweighted.
+	G : graph in which the cut is to be produced, must be unweighted and undirected. Self-loops are ignored.
 	lb : the lower bound of the size of the maximum clique.
 	"""
 	cdef _MaxClique* _this
@@ -6728,6 +7107,41 @@ cdef class MaxClique:
 		"""
 		return self._this.getMaxCliqueSize()
 
+cdef extern from "cpp/clique/BitsetMaxClique.h":
+	cdef cppclass _BitsetMaxClique "NetworKit::BitsetMaxClique"(_Algorithm):
+		_BitsetMaxClique(_Graph G, count lb) except +
+		count getMaxCliqueSize() except +
+		vector[node] getMaxClique() except +
+
+cdef class BitsetMaxClique(Algorithm):
+	"""
+	Exact branch-and-bound algorithm for the maximum clique of an undirected graph. The nodes are ordered by
+	degeneracy, the subproblem of each node is searched with bitset candidate sets and greedy coloring bounds,
+	and the subproblems are searched in parallel.
+
+	Parameters:
+	-----------
+	G : the undirected graph, must not contain self-loops.
+	lb : the lower bound of the size of the maximum clique.
+	"""
+	cdef Graph _G
+
+	def __cinit__(self, Graph G not None, lb=0):
+		self._G = G
+		self._this = new _BitsetMaxClique(G._this, lb)
+
+	def getMaxCliqueSize(self):
+		"""
+		Returns the size of the biggest clique
+		"""
+		return (<_BitsetMaxClique*>(self._this)).getMaxCliqueSize()
+
+	def getMaxClique(self):
+		"""
+		Returns a biggest clique as a sorted list of nodes
+		"""
+		return (<_BitsetMaxClique*>(self._this)).getMaxClique()
+
 # Module: linkprediction
 
 cdef extern from "cpp/linkprediction/LinkPredictor.h":
@@ -7987,7 +8401,7 @@ cdef class TriangleEdgeScore(EdgeScore):
 	Parameters
 	----------
 	G : Graph
-		The graph to count triangles on.
+		The graph to count triangles on, must be undirected.
 	"""
 
 	def __cinit__(self, Graph G):
@@ -1 +1 @@
-from _NetworKit import MaxClique
\ No newline at end of file
+from _NetworKit import MaxClique, BitsetMaxClique
\ No newline at end of file
@@ -48,14 +48,6 @@ count DenseMatrix::nnz() const {
 	return nnz;
 }
 
-double DenseMatrix::operator()(const index i, const index j) const {
-	return entries[i * numberOfColumns() + j];
-}
-
-void DenseMatrix::setValue(const index i, const index j, const double value) {
-	entries[i * numberOfColumns() + j] = value;
-}
-
 Vector DenseMatrix::row(const index i) const {
 	Vector row(numberOfColumns(), zero, true);
 	index offset = i * numberOfColumns();
@@ -229,6 +221,36 @@ Vector DenseMatrix::LUSolve(const DenseMatrix &LU, const Vector &b) {
 	return x;
 }
 
+DenseMatrix DenseMatrix::LUSolve(const DenseMatrix &LU, const DenseMatrix &B) {
+	assert(LU.numberOfRows() == B.numberOfRows());
+	DenseMatrix X = B;
+	const count k = B.numberOfColumns();
+
+	for (index i = 0; i < LU.numberOfRows()-1; ++i) { // forward substitution
+		for (index j = i+1; j < LU.numberOfRows(); ++j) {
+			double value = LU(j,i);
+			for (index c = 0; c < k; ++c) {
+				X.entries[j*k + c] -= X.entries[i*k + c] * value;
+			}
+		}
+	}
+
+	for (index i = LU.numberOfRows(); i-- > 0;) { // backward substitution
+		double diag = LU(i,i);
+		for (index c = 0; c < k; ++c) {
+			X.entries[i*k + c] /= diag;
+		}
+		for (index j = 0; j < i; ++j) {
+			double value = LU(j,i);
+			for (index c = 0; c < k; ++c) {
+				X.entries[j*k + c] -= X.entries[i*k + c] * value;
+			}
+		}
+	}
+
+	return X;
+}
+
 
 
 } /* namespace NetworKit */
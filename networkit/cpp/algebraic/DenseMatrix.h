@@ -127,12 +127,16 @@ public:
 	/**
 	 * @return Value at matrix position (i,j).
 	 */
-	double operator()(const index i, const index j) const;
+	inline double operator()(const index i, const index j) const {
+		return entries[i * numberOfColumns() + j];
+	}
 
 	/**
 	 * Set the matrix at position (@a i, @a j) to @a value.
 	 */
-	void setValue(const index i, const index j, const double value);
+	inline void setValue(const index i, const index j, const double value) {
+		entries[i * numberOfColumns() + j] = value;
+	}
 
 
 	/**
@@ -258,6 +262,15 @@ public:
 	 */
 	static Vector LUSolve(const DenseMatrix &LU, const Vector &b);
 
+	/**
+	 * Computes the solution X to the systems @a LU * X = @a B for all columns of @a B at once, where @a LU is a matrix
+	 * decomposed into L and U. Each entry of @a LU is read once for all columns.
+	 * @param LU Matrix decomposed into lower L and upper U matrix.
+	 * @param B Right-hand sides as columns.
+	 * @return Solution X to the linear equation systems LU * X = B.
+	 */
+	static DenseMatrix LUSolve(const DenseMatrix &LU, const DenseMatrix &B);
+
 	/**
 	 * Computes @a A @a binaryOp @a B on the elements of matrix @a A and matrix @a B.
 	 * @param A
@@ -8,11 +8,14 @@
 #ifndef NETWORKIT_CPP_ALGEBRAIC_GRAPHBLAS_H_
 #define NETWORKIT_CPP_ALGEBRAIC_GRAPHBLAS_H_
 
+#include <algorithm>
 #include <limits>
 #include "Semirings.h"
 #include "SparseAccumulator.h"
 #include "AlgebraicGlobals.h"
 #include "Vector.h"
+#include "SparseVector.h"
+#include "CSRMatrix.h"
 
 /**
  * @ingroup algebraic
@@ -20,6 +23,98 @@
  */
 namespace GraphBLAS {
 
+namespace Impl {
+
+/**
+ * Constructs a @a nRows x @a nCols matrix from the arrays of the CSR format.
+ */
+template<class Matrix>
+Matrix fromCSR(NetworKit::count nRows, NetworKit::count nCols, const std::vector<NetworKit::index>& rowIdx, const std::vector<NetworKit::index>& columnIdx, const std::vector<double>& nonZeros, double zero) {
+	std::vector<NetworKit::Triplet> triplets(nonZeros.size());
+#pragma omp parallel for
+	for (NetworKit::index i = 0; i < nRows; ++i) {
+		for (NetworKit::index k = rowIdx[i]; k < rowIdx[i+1]; ++k) {
+			triplets[k] = {i, columnIdx[k], nonZeros[k]};
+		}
+	}
+
+	return Matrix(nRows, nCols, triplets, zero);
+}
+
+template<>
+inline NetworKit::CSRMatrix fromCSR<NetworKit::CSRMatrix>(NetworKit::count nRows, NetworKit::count nCols, const std::vector<NetworKit::index>& rowIdx, const std::vector<NetworKit::index>& columnIdx, const std::vector<double>& nonZeros, double zero) {
+	return NetworKit::CSRMatrix(nRows, nCols, rowIdx, columnIdx, nonZeros, zero, true);
+}
+
+/**
+ * Computes A * B over the SemiRing in two parallel passes over the rows of @a A. The symbolic pass counts the
+ * non-zeros of each result row, the numeric pass accumulates the products of each row in a per-thread
+ * SparseAccumulator and writes them sorted by column to the position of the row in the CSR arrays. The result
+ * has @a zero as zero element.
+ */
+template<class SemiRing, class Matrix>
+Matrix spgemm(const Matrix& A, const Matrix& B, double zero) {
+	const NetworKit::count nRows = A.numberOfRows();
+	const NetworKit::count nCols = B.numberOfColumns();
+	std::vector<NetworKit::index> rowIdx(nRows+1, 0);
+	std::vector<NetworKit::index> columnIdx;
+	std::vector<double> nonZeros;
+
+#pragma omp parallel
+	{
+		// symbolic phase
+		std::vector<NetworKit::index> marker(nCols, NetworKit::none);
+#pragma omp for schedule(guided)
+		for (NetworKit::index i = 0; i < nRows; ++i) {
+			A.forNonZeroElementsInRow(i, [&](NetworKit::index k, double) {
+				B.forNonZeroElementsInRow(k, [&](NetworKit::index j, double) {
+					if (marker[j] != i) {
+						marker[j] = i;
+						++rowIdx[i+1];
+					}
+				});
+			});
+		}
+
+#pragma omp single
+		{
+			for (NetworKit::index i = 0; i < nRows; ++i) {
+				rowIdx[i+1] += rowIdx[i];
+			}
+
+			columnIdx.resize(rowIdx[nRows]);
+			nonZeros.resize(rowIdx[nRows]);
+		}
+
+		// numeric phase
+		NetworKit::SparseAccumulator spa(nCols);
+#pragma omp for schedule(guided)
+		for (NetworKit::index i = 0; i < nRows; ++i) {
+			A.forNonZeroElementsInRow(i, [&](NetworKit::index k, double w1) {
+				B.forNonZeroElementsInRow(k, [&](NetworKit::index j, double w2) {
+					spa.scatter(SemiRing::mult(w1,w2), j, *SemiRing::add);
+				});
+			});
+
+			NetworKit::index pos = rowIdx[i];
+			spa.gather([&](NetworKit::index, NetworKit::index j, double value) {
+				columnIdx[pos] = j;
+				nonZeros[pos] = value;
+				++pos;
+			});
+
+			spa.increaseRow();
+		}
+	}
+
+	return fromCSR<Matrix>(nRows, nCols, rowIdx, columnIdx, nonZeros, zero);
+}
+
+/** MxSpV pulls once the rows pushed from the frontier hold more than 1/pushPullRatio of all non-zeros */
+constexpr double pushPullRatio = 14.0;
+
+} // namespace Impl
+
 // ****************************************************
 // 						Operations
 // ****************************************************
@@ -102,23 +197,7 @@ Matrix MxM(const Matrix& A, const Matrix& B) {
 	assert(A.numberOfColumns() == B.numberOfRows());
 	assert(A.getZero() == SemiRing::zero() && B.getZero() == SemiRing::zero());
 
-	std::vector<NetworKit::Triplet> triplets;
-	NetworKit::SparseAccumulator spa(B.numberOfRows());
-	for (NetworKit::index i = 0; i < A.numberOfRows(); ++i) {
-		A.forNonZeroElementsInRow(i, [&](NetworKit::index k, double w1) {
-			B.forNonZeroElementsInRow(k, [&](NetworKit::index j, double w2) {
-				spa.scatter(SemiRing::mult(w1,w2), j, *SemiRing::add);
-			});
-		});
-
-		spa.gather([&](NetworKit::index i, NetworKit::index j, double value){
-			triplets.push_back({i,j,value});
-		});
-
-		spa.increaseRow();
-	}
-
-	return Matrix(A.numberOfRows(), B.numberOfColumns(), triplets, A.getZero());
+	return Impl::spgemm<SemiRing>(A, B, A.getZero());
 }
 
 /**
@@ -134,23 +213,7 @@ void MxM(const Matrix& A, const Matrix& B, Matrix& C) {
 	assert(A.numberOfColumns() == B.numberOfRows() && A.numberOfRows() == C.numberOfRows() && B.numberOfColumns() == C.numberOfColumns());
 	assert(A.getZero() == SemiRing::zero() && B.getZero() == SemiRing::zero() && C.getZero() == SemiRing::zero());
 
-	std::vector<NetworKit::Triplet> triplets;
-	NetworKit::SparseAccumulator spa(B.numberOfRows());
-	for (NetworKit::index i = 0; i < A.numberOfRows(); ++i) {
-		A.forNonZeroElementsInRow(i, [&](NetworKit::index k, double w1) {
-			B.forNonZeroElementsInRow(k, [&](NetworKit::index j, double w2) {
-				spa.scatter(SemiRing::mult(w1,w2), j, *SemiRing::add);
-			});
-		});
-
-		spa.gather([&](NetworKit::index i, NetworKit::index j, double value){
-			triplets.push_back({i,j,value});
-		});
-
-		spa.increaseRow();
-	}
-
-	Matrix temp(A.numberOfRows(), B.numberOfRows(), triplets, A.getZero());
+	Matrix temp = Impl::spgemm<SemiRing>(A, B, A.getZero());
 	C = eWiseBinOp<SemiRing, Matrix>(C, temp, *SemiRing::add);
 }
 
@@ -168,23 +231,7 @@ void MxM(const Matrix& A, const Matrix& B, Matrix& C, F accum) {
 	assert(A.numberOfColumns() == B.numberOfRows() && A.numberOfRows() == C.numberOfRows() && B.numberOfColumns() == C.numberOfColumns());
 	assert(A.getZero() == SemiRing::zero() && B.getZero() == SemiRing::zero() && C.getZero() == SemiRing::zero());
 
-	std::vector<NetworKit::Triplet> triplets;
-	NetworKit::SparseAccumulator spa(B.numberOfRows());
-	for (NetworKit::index i = 0; i < A.numberOfRows(); ++i) {
-		A.forNonZeroElementsInRow(i, [&](NetworKit::index k, double w1) {
-			B.forNonZeroElementsInRow(k, [&](NetworKit::index j, double w2) {
-				spa.scatter(SemiRing::mult(w1,w2), j, *SemiRing::add);
-			});
-		});
-
-		spa.gather([&](NetworKit::index i, NetworKit::index j, double value){
-			triplets.push_back({i,j,value});
-		});
-
-		spa.increaseRow();
-	}
-
-	Matrix temp(A.numberOfRows(), B.numberOfRows(), triplets, A.getZero());
+	Matrix temp = Impl::spgemm<SemiRing>(A, B, A.getZero());
 	C = eWiseBinOp<SemiRing, Matrix>(C, temp, accum);
 }
 
@@ -245,6 +292,111 @@ void MxV(const Matrix& A, const NetworKit::Vector& v, NetworKit::Vector& c, F ac
 	});
 }
 
+/**
+ * Computes the matrix-vector product of matrix @a A and the SparseVector @a x and adds it to @a c where the add
+ * operation is that of the specified Semiring (i.e. c[i] = SemiRing::add(c[i], (A*x)[i])) for all entries i with
+ * mask(i) == true. @a At has to be the transpose of @a A. If the rows of @a At belonging to the entries of @a x are
+ * sparse compared to @a A, the products are pushed along these rows. Otherwise every row i of @a A that passes the
+ * mask pulls from the entries of @a x. The default Semiring is the ArithmeticSemiring.
+ * @param A
+ * @param At The transpose of @a A.
+ * @param x
+ * @param c
+ * @param mask bool(index i) that returns whether entry i of @a c may be updated.
+ * @return The entries of @a c that changed with their new values.
+ */
+template<class SemiRing = ArithmeticSemiring, class Matrix, typename M>
+NetworKit::SparseVector MxSpV(const Matrix& A, const Matrix& At, const NetworKit::SparseVector& x, NetworKit::Vector& c, M mask) {
+	assert(A.numberOfColumns() == x.getDimension() && A.numberOfRows() == c.getDimension());
+	assert(At.numberOfRows() == A.numberOfColumns() && At.numberOfColumns() == A.numberOfRows());
+	assert(A.getZero() == SemiRing::zero() && x.getZero() == SemiRing::zero());
+
+	NetworKit::SparseVector changed(c.getDimension(), SemiRing::zero());
+	NetworKit::count pushWork = 0;
+	for (NetworKit::index k = 0; k < x.nnz(); ++k) {
+		pushWork += At.nnzInRow(x.indexAt(k));
+	}
+
+	if (pushWork * Impl::pushPullRatio < A.nnz()) { // push
+		std::vector<std::pair<NetworKit::index, double>> products;
+#pragma omp parallel
+		{
+			std::vector<std::pair<NetworKit::index, double>> localProducts;
+#pragma omp for schedule(guided) nowait
+			for (NetworKit::index k = 0; k < x.nnz(); ++k) {
+				double xj = x.valueAt(k);
+				At.forNonZeroElementsInRow(x.indexAt(k), [&](NetworKit::index i, double value) {
+					if (mask(i)) {
+						localProducts.emplace_back(i, SemiRing::mult(value, xj));
+					}
+				});
+			}
+
+#pragma omp critical
+			products.insert(products.end(), localProducts.begin(), localProducts.end());
+		}
+
+		std::vector<NetworKit::index> updated;
+		for (auto product : products) {
+			double value = SemiRing::add(c[product.first], product.second);
+			if (value != c[product.first]) {
+				c[product.first] = value;
+				updated.push_back(product.first);
+			}
+		}
+
+		std::sort(updated.begin(), updated.end());
+		updated.erase(std::unique(updated.begin(), updated.end()), updated.end());
+		for (NetworKit::index i : updated) {
+			changed.insert(i, c[i]);
+		}
+	} else { // pull
+		NetworKit::Vector xDense = x.toDense();
+#pragma omp parallel
+		{
+			std::vector<NetworKit::index> updated;
+#pragma omp for schedule(guided) nowait
+			for (NetworKit::index i = 0; i < A.numberOfRows(); ++i) {
+				if (!mask(i)) continue;
+				double value = c[i];
+				A.forNonZeroElementsInRow(i, [&](NetworKit::index j, double aij) {
+					if (xDense[j] != SemiRing::zero()) {
+						value = SemiRing::add(value, SemiRing::mult(aij, xDense[j]));
+					}
+				});
+
+				if (value != c[i]) {
+					c[i] = value;
+					updated.push_back(i);
+				}
+			}
+
+#pragma omp critical
+			for (NetworKit::index i : updated) {
+				changed.insert(i, c[i]);
+			}
+		}
+	}
+
+	return changed;
+}
+
+/**
+ * Computes the matrix-vector product of matrix @a A and the SparseVector @a x and adds it to @a c where the add
+ * operation is that of the specified Semiring (i.e. c[i] = SemiRing::add(c[i], (A*x)[i])). @a At has to be the
+ * transpose of @a A and is used to push the products of sparse vectors. The default Semiring is the
+ * ArithmeticSemiring.
+ * @param A
+ * @param At The transpose of @a A.
+ * @param x
+ * @param c
+ * @return The entries of @a c that changed with their new values.
+ */
+template<class SemiRing = ArithmeticSemiring, class Matrix>
+NetworKit::SparseVector MxSpV(const Matrix& A, const Matrix& At, const NetworKit::SparseVector& x, NetworKit::Vector& c) {
+	return MxSpV<SemiRing>(A, At, x, c, [](NetworKit::index) {return true;});
+}
+
 /**
  * Computes SemiRing::add(A(i,j), B(i,j)) for all i,j element-wise and returns the resulting matrix. The default
  * Semiring is the ArithmeticSemiring.
@@ -0,0 +1,240 @@
+/*
+ * SellCSigmaMatrix.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: NetworKit contributors
+ */
+
+#include "SellCSigmaMatrix.h"
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+
+namespace NetworKit {
+
+constexpr count SellCSigmaMatrix::chunkHeight;
+constexpr count SellCSigmaMatrix::defaultSigma;
+
+SellCSigmaMatrix::SellCSigmaMatrix() : SellCSigmaMatrix(CSRMatrix()) {
+}
+
+SellCSigmaMatrix::SellCSigmaMatrix(const count dimension, const double zero) : SellCSigmaMatrix(CSRMatrix(dimension, zero)) {
+}
+
+SellCSigmaMatrix::SellCSigmaMatrix(const count nRows, const count nCols, const double zero) : SellCSigmaMatrix(CSRMatrix(nRows, nCols, zero)) {
+}
+
+SellCSigmaMatrix::SellCSigmaMatrix(const count dimension, const std::vector<Triplet>& triplets, const double zero) : SellCSigmaMatrix(CSRMatrix(dimension, triplets, zero)) {
+}
+
+SellCSigmaMatrix::SellCSigmaMatrix(const count nRows, const count nCols, const std::vector<Triplet>& triplets, const double zero) : SellCSigmaMatrix(CSRMatrix(nRows, nCols, triplets, zero)) {
+}
+
+SellCSigmaMatrix::SellCSigmaMatrix(const CSRMatrix& matrix, const count sigma) : nRows(matrix.numberOfRows()), nCols(matrix.numberOfColumns()), sigma(std::max((sigma + chunkHeight - 1) / chunkHeight, (count) 1) * chunkHeight), zero(matrix.getZero()) {
+	initialize(matrix);
+}
+
+void SellCSigmaMatrix::initialize(const CSRMatrix& matrix) {
+	const count numChunks = (nRows + chunkHeight - 1) / chunkHeight;
+	permutation = std::vector<index>(nRows);
+	rowPosition = std::vector<index>(nRows);
+	rowLength = std::vector<count>(numChunks * chunkHeight, 0);
+	std::iota(permutation.begin(), permutation.end(), 0);
+
+	// sort the rows by decreasing length within each window of sigma rows
+#pragma omp parallel for schedule(dynamic)
+	for (index window = 0; window < nRows; window += sigma) {
+		auto end = permutation.begin() + std::min(window + sigma, nRows);
+		std::stable_sort(permutation.begin() + window, end, [&](index u, index v) {
+			return matrix.nnzInRow(u) > matrix.nnzInRow(v);
+		});
+	}
+
+#pragma omp parallel for
+	for (index pos = 0; pos < nRows; ++pos) {
+		rowLength[pos] = matrix.nnzInRow(permutation[pos]);
+		rowPosition[permutation[pos]] = pos;
+	}
+
+	chunkWidth = std::vector<count>(numChunks, 0);
+	chunkOffset = std::vector<index>(numChunks + 1, 0);
+	for (index c = 0; c < numChunks; ++c) {
+		for (index pos = c * chunkHeight; pos < (c + 1) * chunkHeight; ++pos) {
+			chunkWidth[c] = std::max(chunkWidth[c], rowLength[pos]);
+		}
+		chunkOffset[c+1] = chunkOffset[c] + chunkWidth[c] * chunkHeight;
+	}
+
+	// padding elements have value 0.0 and repeat the last column of their row so that they stay in cache
+	columnIdx = std::vector<index>(chunkOffset[numChunks], 0);
+	nonZeros = std::vector<double>(chunkOffset[numChunks], 0.0);
+
+#pragma omp parallel for
+	for (index pos = 0; pos < nRows; ++pos) {
+		index k = 0;
+		index lastColumn = 0;
+		matrix.forNonZeroElementsInRow(permutation[pos], [&](index j, double value) {
+			index idx = entry(pos, k++);
+			columnIdx[idx] = j;
+			nonZeros[idx] = value;
+			lastColumn = j;
+		});
+
+		for (; k < chunkWidth[pos / chunkHeight]; ++k) {
+			columnIdx[entry(pos, k)] = lastColumn;
+		}
+	}
+}
+
+count SellCSigmaMatrix::nnzInRow(const index i) const {
+	assert(i >= 0 && i < nRows);
+	return rowLength[rowPosition[i]];
+}
+
+count SellCSigmaMatrix::nnz() const {
+	return std::accumulate(rowLength.begin(), rowLength.end(), (count) 0);
+}
+
+count SellCSigmaMatrix::storedElements() const {
+	return nonZeros.size();
+}
+
+double SellCSigmaMatrix::operator()(const index i, const index j) const {
+	assert(i >= 0 && i < nRows);
+	assert(j >= 0 && j < nCols);
+
+	double value = zero;
+	index pos = rowPosition[i];
+	for (index k = 0; k < rowLength[pos]; ++k) {
+		index idx = entry(pos, k);
+		if (columnIdx[idx] == j) {
+			value = nonZeros[idx];
+			break;
+		}
+	}
+
+	return value;
+}
+
+Vector SellCSigmaMatrix::row(const index i) const {
+	assert(i >= 0 && i < nRows);
+
+	Vector row(numberOfColumns(), zero, true);
+	forNonZeroElementsInRow(i, [&](index j, double value) {
+		row[j] = value;
+	});
+
+	return row;
+}
+
+Vector SellCSigmaMatrix::column(const index j) const {
+	assert(j >= 0 && j < nCols);
+
+	Vector column(numberOfRows(), getZero());
+#pragma omp parallel for
+	for (index i = 0; i < numberOfRows(); ++i) {
+		column[i] = (*this)(i,j);
+	}
+
+	return column;
+}
+
+Vector SellCSigmaMatrix::diagonal() const {
+	Vector diag(std::min(nRows, nCols), zero);
+
+#pragma omp parallel for
+	for (index i = 0; i < diag.getDimension(); ++i) {
+		diag[i] = (*this)(i,i);
+	}
+
+	return diag;
+}
+
+SellCSigmaMatrix SellCSigmaMatrix::operator*(const double &scalar) const {
+	return SellCSigmaMatrix(*this) *= scalar;
+}
+
+SellCSigmaMatrix& SellCSigmaMatrix::operator*=(const double &scalar) {
+	apply([&](double value) {return value * scalar;});
+	return *this;
+}
+
+Vector SellCSigmaMatrix::operator*(const Vector &vector) const {
+	assert(!vector.isTransposed());
+	assert(nCols == vector.getDimension());
+
+	Vector result(nRows, zero);
+	const index *columns = columnIdx.data();
+	const double *values = nonZeros.data();
+
+#pragma omp parallel for schedule(guided)
+	for (index c = 0; c < chunkWidth.size(); ++c) {
+		double sum[chunkHeight];
+		std::fill(sum, sum + chunkHeight, zero);
+
+		// the elements of all rows of the chunk are stored next to each other for each k
+		for (index k = 0, idx = chunkOffset[c]; k < chunkWidth[c]; ++k, idx += chunkHeight) {
+#pragma omp simd
+			for (index l = 0; l < chunkHeight; ++l) {
+				sum[l] += values[idx + l] * vector[columns[idx + l]];
+			}
+		}
+
+		for (index pos = c * chunkHeight; pos < std::min((c + 1) * chunkHeight, nRows); ++pos) {
+			result[permutation[pos]] = sum[pos - c * chunkHeight];
+		}
+	}
+
+	return result;
+}
+
+SellCSigmaMatrix SellCSigmaMatrix::operator/(const double &divisor) const {
+	return SellCSigmaMatrix(*this) /= divisor;
+}
+
+SellCSigmaMatrix& SellCSigmaMatrix::operator/=(const double &divisor) {
+	apply([&](double value) {return value / divisor;});
+	return *this;
+}
+
+SellCSigmaMatrix SellCSigmaMatrix::transpose() const {
+	return SellCSigmaMatrix(toCSRMatrix().transpose(), sigma);
+}
+
+CSRMatrix SellCSigmaMatrix::toCSRMatrix() const {
+	std::vector<index> rowIdx(nRows + 1, 0);
+	for (index i = 0; i < nRows; ++i) {
+		rowIdx[i+1] = rowIdx[i] + nnzInRow(i);
+	}
+
+	std::vector<index> columns(rowIdx[nRows]);
+	std::vector<double> values(rowIdx[nRows]);
+#pragma omp parallel for
+	for (index i = 0; i < nRows; ++i) {
+		index k = rowIdx[i];
+		forNonZeroElementsInRow(i, [&](index j, double value) {
+			columns[k] = j;
+			values[k] = value;
+			++k;
+		});
+	}
+
+	CSRMatrix matrix(nRows, nCols, rowIdx, columns, values, zero);
+	matrix.sort();
+	return matrix;
+}
+
+SellCSigmaMatrix SellCSigmaMatrix::adjacencyMatrix(const Graph& graph, double zero) {
+	return SellCSigmaMatrix(CSRMatrix::adjacencyMatrix(graph, zero));
+}
+
+SellCSigmaMatrix SellCSigmaMatrix::laplacianMatrix(const Graph& graph, double zero) {
+	return SellCSigmaMatrix(CSRMatrix::laplacianMatrix(graph, zero));
+}
+
+SellCSigmaMatrix SellCSigmaMatrix::normalizedLaplacianMatrix(const Graph& graph, double zero) {
+	return SellCSigmaMatrix(CSRMatrix::normalizedLaplacianMatrix(graph, zero));
+}
+
+} /* namespace NetworKit */
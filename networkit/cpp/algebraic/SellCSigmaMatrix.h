@@ -0,0 +1,341 @@
+/*
+ * SellCSigmaMatrix.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef SELLCSIGMAMATRIX_H_
+#define SELLCSIGMAMATRIX_H_
+
+#include <vector>
+#include "../Globals.h"
+#include "AlgebraicGlobals.h"
+#include "Vector.h"
+#include "CSRMatrix.h"
+#include "../graph/Graph.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup algebraic
+ * The SellCSigmaMatrix class represents a sparse matrix stored in the SELL-C-sigma format (sliced ELLPACK).
+ * Rows are grouped into chunks of @ref chunkHeight rows that are stored column by column and padded to the longest
+ * row of the chunk. Within windows of sigma rows, rows are sorted by decreasing length to keep the padding small.
+ * The matrix-vector product then processes @ref chunkHeight rows at once with contiguous loads, which lets the
+ * compiler vectorize it also on matrices with a skewed row length distribution like Laplacians of power-law graphs.
+ * The matrix is constructed from a CSRMatrix and is meant to be read only; use it if many matrix-vector products
+ * with the same matrix are computed.
+ */
+class SellCSigmaMatrix {
+public:
+	/** number of rows stored together in one chunk */
+	static constexpr count chunkHeight = 8;
+
+	/** default number of rows within which rows are sorted by length */
+	static constexpr count defaultSigma = 32 * chunkHeight;
+
+private:
+	std::vector<index> chunkOffset; // start of each chunk in columnIdx and nonZeros
+	std::vector<count> chunkWidth; // length of the longest row in each chunk
+	std::vector<count> rowLength; // number of non-zeros of the row at each position
+	std::vector<index> permutation; // row stored at each position
+	std::vector<index> rowPosition; // position of each row
+	std::vector<index> columnIdx;
+	std::vector<double> nonZeros;
+
+	count nRows;
+	count nCols;
+	count sigma;
+	double zero;
+
+	/**
+	 * Stores @a matrix in SELL-C-sigma format.
+	 * @param matrix
+	 */
+	void initialize(const CSRMatrix& matrix);
+
+	/**
+	 * @return The index in columnIdx and nonZeros of the @a k-th element of the row at @a position.
+	 */
+	inline index entry(index position, index k) const {
+		return chunkOffset[position / chunkHeight] + k * chunkHeight + position % chunkHeight;
+	}
+
+public:
+	/** Default constructor */
+	SellCSigmaMatrix();
+
+	/**
+	 * Constructs the SellCSigmaMatrix with size @a dimension x @a dimension.
+	 * @param dimension Defines how many rows and columns this matrix has.
+	 * @param zero The zero element (default = 0.0).
+	 */
+	SellCSigmaMatrix(const count dimension, const double zero = 0.0);
+
+	/**
+	 * Constructs the SellCSigmaMatrix with size @a nRows x @a nCols.
+	 * @param nRows Number of rows.
+	 * @param nCols Number of columns.
+	 * @param zero The zero element (default = 0.0).
+	 */
+	SellCSigmaMatrix(const count nRows, const count nCols, const double zero = 0.0);
+
+	/**
+	 * Constructs the @a dimension x @a dimension Matrix from the elements in @a triplets.
+	 * @param dimension Defines how many rows and columns this matrix has.
+	 * @param triplets The nonzero elements.
+	 * @param zero The zero element (default is 0.0).
+	 */
+	SellCSigmaMatrix(const count dimension, const std::vector<Triplet>& triplets, const double zero = 0.0);
+
+	/**
+	 * Constructs the @a nRows x @a nCols Matrix from the elements in @a triplets.
+	 * @param nRows Defines how many rows this matrix has.
+	 * @param nCols Defines how many columns this matrix has.
+	 * @param triplets The nonzero elements.
+	 * @param zero The zero element (default is 0.0).
+	 */
+	SellCSigmaMatrix(const count nRows, const count nCols, const std::vector<Triplet>& triplets, const double zero = 0.0);
+
+	/**
+	 * Converts the CSRMatrix @a matrix to SELL-C-sigma format. Rows are sorted by length within windows of
+	 * @a sigma rows, @a sigma is rounded up to a multiple of @ref chunkHeight. A @a sigma of @ref chunkHeight keeps
+	 * the row order, larger values reduce padding but scatter the rows of the result.
+	 * @param matrix
+	 * @param sigma The sorting window (default is @ref defaultSigma).
+	 */
+	explicit SellCSigmaMatrix(const CSRMatrix& matrix, const count sigma = defaultSigma);
+
+	/** Default copy constructor */
+	SellCSigmaMatrix (const SellCSigmaMatrix &other) = default;
+
+	/** Default move constructor */
+	SellCSigmaMatrix (SellCSigmaMatrix &&other) = default;
+
+	/** Default destructor */
+	virtual ~SellCSigmaMatrix() = default;
+
+	/** Default move assignment operator */
+	SellCSigmaMatrix& operator=(SellCSigmaMatrix &&other) = default;
+
+	/** Default copy assignment operator */
+	SellCSigmaMatrix& operator=(const SellCSigmaMatrix &other) = default;
+
+	/**
+	 * @return Number of rows.
+	 */
+	inline count numberOfRows() const {
+		return nRows;
+	}
+
+	/**
+	 * @return Number of columns.
+	 */
+	inline count numberOfColumns() const {
+		return nCols;
+	}
+
+	/**
+	 * Returns the zero element of the matrix.
+	 */
+	inline double getZero() const {
+		return zero;
+	}
+
+	/**
+	 * @return The sorting window of this matrix.
+	 */
+	inline count getSigma() const {
+		return sigma;
+	}
+
+	/**
+	 * @param i The row index.
+	 * @return Number of non-zeros in row @a i.
+	 */
+	count nnzInRow(const index i) const;
+
+	/**
+	 * @return Number of non-zeros in this matrix.
+	 */
+	count nnz() const;
+
+	/**
+	 * @return The number of stored elements including the padding of the chunks.
+	 */
+	count storedElements() const;
+
+	/**
+	 * @return Value at matrix position (i,j).
+	 */
+	double operator()(const index i, const index j) const;
+
+	/**
+	 * @return Row @a i of this matrix as vector.
+	 */
+	Vector row(const index i) const;
+
+	/**
+	 * @return Column @a j of this matrix as vector.
+	 */
+	Vector column(const index j) const;
+
+	/**
+	 * @return The main diagonal elements of the matrix.
+	 */
+	Vector diagonal() const;
+
+	/**
+	 * Multiplies this matrix with a scalar specified in @a scalar and returns the result.
+	 * @return The result of multiplying this matrix with @a scalar.
+	 */
+	SellCSigmaMatrix operator*(const double &scalar) const;
+
+	/**
+	 * Multiplies this matrix with a scalar specified in @a scalar.
+	 * @return Reference to this matrix.
+	 */
+	SellCSigmaMatrix& operator*=(const double &scalar);
+
+	/**
+	 * Multiplies this matrix with @a vector and returns the result.
+	 * @return The result of multiplying this matrix with @a vector.
+	 */
+	Vector operator*(const Vector &vector) const;
+
+	/**
+	 * Divides this matrix by a divisor specified in @a divisor and returns the result in a new matrix.
+	 * @return The result of dividing this matrix by @a divisor.
+	 */
+	SellCSigmaMatrix operator/(const double &divisor) const;
+
+	/**
+	 * Divides this matrix by a divisor specified in @a divisor.
+	 * @return Reference to this matrix.
+	 */
+	SellCSigmaMatrix& operator/=(const double &divisor);
+
+	/**
+	 * Transposes this matrix and returns it.
+	 */
+	SellCSigmaMatrix transpose() const;
+
+	/**
+	 * @return This matrix in CSR format with sorted rows.
+	 */
+	CSRMatrix toCSRMatrix() const;
+
+	/**
+	 * Applies the unary function @a unaryElementFunction to each value in the matrix. Note that it must hold that the
+	 * function applied to the zero element of this matrix returns the zero element.
+	 * @param unaryElementFunction
+	 */
+	template<typename F>
+	void apply(const F unaryElementFunction);
+
+	/**
+	 * Returns the (weighted) adjacency matrix of the (weighted) Graph @a graph.
+	 * @param graph
+	 */
+	static SellCSigmaMatrix adjacencyMatrix(const Graph& graph, double zero = 0.0);
+
+	/**
+	 * Returns the Laplacian matrix of the Graph @a graph.
+	 * @param graph
+	 */
+	static SellCSigmaMatrix laplacianMatrix(const Graph& graph, double zero = 0.0);
+
+	/**
+	 * Returns the normalized Laplacian matrix of the Graph @a graph.
+	 * @param graph
+	 */
+	static SellCSigmaMatrix normalizedLaplacianMatrix(const Graph& graph, double zero = 0.0);
+
+	/**
+	 * Iterate over all non-zero elements of row @a row in the matrix and call handle(index column, double value)
+	 */
+	template<typename L> void forNonZeroElementsInRow(index row, L handle) const;
+
+	/**
+	 * Iterate over all non-zero elements of row @a row in the matrix in parallel and call handle(index column, double value)
+	 */
+	template<typename L> void parallelForNonZeroElementsInRow(index row, L handle) const;
+
+	/**
+	 * Iterate over all elements in row @a i in the matrix and call handle(index column, double value)
+	 */
+	template<typename L> void forElementsInRow(index i, L handle) const;
+
+	/**
+	 * Iterate over all non-zero elements of the matrix in row order and call handle(index row, index column, double value).
+	 */
+	template<typename L> void forNonZeroElementsInRowOrder(L handle) const;
+
+	/**
+	 * Iterate in parallel over all rows and call handle(index row, index column, double value) for non-zero elements in the matrix.
+	 */
+	template<typename L> void parallelForNonZeroElementsInRowOrder(L handle) const;
+};
+
+template<typename F>
+void SellCSigmaMatrix::apply(const F unaryElementFunction) {
+#pragma omp parallel for
+	for (index pos = 0; pos < nRows; ++pos) {
+		for (index k = 0; k < rowLength[pos]; ++k) {
+			index idx = entry(pos, k);
+			nonZeros[idx] = unaryElementFunction(nonZeros[idx]);
+		}
+	}
+}
+
+} /* namespace NetworKit */
+
+template<typename L>
+inline void NetworKit::SellCSigmaMatrix::forNonZeroElementsInRow(index i, L handle) const {
+	index pos = rowPosition[i];
+	for (index k = 0; k < rowLength[pos]; ++k) {
+		index idx = entry(pos, k);
+		handle(columnIdx[idx], nonZeros[idx]);
+	}
+}
+
+template<typename L>
+inline void NetworKit::SellCSigmaMatrix::parallelForNonZeroElementsInRow(index i, L handle) const {
+	index pos = rowPosition[i];
+#pragma omp parallel for
+	for (index k = 0; k < rowLength[pos]; ++k) {
+		index idx = entry(pos, k);
+		handle(columnIdx[idx], nonZeros[idx]);
+	}
+}
+
+template<typename L>
+inline void NetworKit::SellCSigmaMatrix::forElementsInRow(index i, L handle) const {
+	Vector rowVector = row(i);
+	index j = 0;
+	rowVector.forElements([&](double val) {
+		handle(j++, val);
+	});
+}
+
+template<typename L>
+inline void NetworKit::SellCSigmaMatrix::forNonZeroElementsInRowOrder(L handle) const {
+	for (index i = 0; i < nRows; ++i) {
+		forNonZeroElementsInRow(i, [&](index j, double value) {
+			handle(i, j, value);
+		});
+	}
+}
+
+template<typename L>
+inline void NetworKit::SellCSigmaMatrix::parallelForNonZeroElementsInRowOrder(L handle) const {
+#pragma omp parallel for
+	for (index i = 0; i < nRows; ++i) {
+		forNonZeroElementsInRow(i, [&](index j, double value) {
+			handle(i, j, value);
+		});
+	}
+}
+
+#endif /* SELLCSIGMAMATRIX_H_ */
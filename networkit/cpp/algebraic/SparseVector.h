@@ -0,0 +1,121 @@
+/*
+ * SparseVector.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef NETWORKIT_CPP_ALGEBRAIC_SPARSEVECTOR_H_
+#define NETWORKIT_CPP_ALGEBRAIC_SPARSEVECTOR_H_
+
+#include <vector>
+#include <cassert>
+#include "../Globals.h"
+#include "Vector.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup algebraic
+ * The SparseVector class stores the non-zero entries of a vector as a list of (index, value) pairs. All other
+ * entries are equal to the zero element. It is used to represent sparse frontiers in the GraphBLAS interface.
+ */
+class SparseVector {
+private:
+	count dimension;
+	double zero;
+	std::vector<index> indices;
+	std::vector<double> values;
+
+public:
+	/**
+	 * Constructs an empty SparseVector of dimension @a dimension.
+	 * @param dimension
+	 * @param zero The zero element (default is 0.0).
+	 */
+	SparseVector(const count dimension = 0, const double zero = 0.0) : dimension(dimension), zero(zero) {}
+
+	/**
+	 * @return The dimension of this vector.
+	 */
+	inline count getDimension() const {
+		return dimension;
+	}
+
+	/**
+	 * @return The zero element of this vector.
+	 */
+	inline double getZero() const {
+		return zero;
+	}
+
+	/**
+	 * @return The number of stored entries.
+	 */
+	inline count nnz() const {
+		return indices.size();
+	}
+
+	/**
+	 * @return True if no entry is stored.
+	 */
+	inline bool isEmpty() const {
+		return indices.empty();
+	}
+
+	/**
+	 * Stores @a value at position @a i. The caller is responsible that @a i is not stored already.
+	 */
+	inline void insert(const index i, const double value) {
+		assert(i < dimension);
+		indices.push_back(i);
+		values.push_back(value);
+	}
+
+	/**
+	 * Removes all entries.
+	 */
+	inline void clear() {
+		indices.clear();
+		values.clear();
+	}
+
+	/**
+	 * @return The position of the @a k-th stored entry.
+	 */
+	inline index indexAt(const index k) const {
+		return indices[k];
+	}
+
+	/**
+	 * @return The value of the @a k-th stored entry.
+	 */
+	inline double valueAt(const index k) const {
+		return values[k];
+	}
+
+	/**
+	 * @return This vector as dense Vector.
+	 */
+	Vector toDense() const {
+		Vector dense(dimension, zero);
+		for (index k = 0; k < indices.size(); ++k) {
+			dense[indices[k]] = values[k];
+		}
+
+		return dense;
+	}
+
+	/**
+	 * Iterate over all stored entries and call handle(index i, double value).
+	 */
+	template<typename L> void forElements(L handle) const {
+		for (index k = 0; k < indices.size(); ++k) {
+			handle(indices[k], values[k]);
+		}
+	}
+};
+
+} /* namespace NetworKit */
+
+#endif /* NETWORKIT_CPP_ALGEBRAIC_SPARSEVECTOR_H_ */
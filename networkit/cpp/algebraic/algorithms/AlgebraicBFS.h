@@ -17,7 +17,8 @@ namespace NetworKit {
 
 /**
  * @ingroup algebraic
- * Implementation of Breadth-First-Search using the GraphBLAS interface.
+ * Implementation of Breadth-First-Search using the GraphBLAS interface. On weighted graphs, the distances are the
+ * weighted shortest path distances (the edge weights must be non-negative), otherwise the number of hops.
  */
 template<class Matrix>
 class AlgebraicBFS : public Algorithm {
@@ -27,10 +28,11 @@ public:
 	 * @param graph
 	 * @param source
 	 */
-	AlgebraicBFS(const Graph& graph, node source) : At(Matrix::adjacencyMatrix(graph, MinPlusSemiring::zero()).transpose()), source(source) {}
+	AlgebraicBFS(const Graph& graph, node source) : A(Matrix::adjacencyMatrix(graph, MinPlusSemiring::zero())), At(A.transpose()), source(source), weighted(graph.isWeighted()) {}
 
 	/**
-	 * Runs a bfs using the GraphBLAS interface from the source node.
+	 * Runs a bfs using the GraphBLAS interface from the source node. On weighted graphs, the nodes whose distance
+	 * changed are relaxed again until no distance changes.
 	 */
 	void run();
 
@@ -45,8 +47,10 @@ public:
 	}
 
 private:
+	Matrix A;
 	Matrix At;
 	node source;
+	bool weighted;
 	Vector distances;
 };
 
@@ -56,11 +60,19 @@ void AlgebraicBFS<Matrix>::run() {
 	distances = Vector(n, std::numeric_limits<double>::infinity());
 	distances[source] = 0;
 
-	Vector oldDist;
-	do {
-		oldDist = distances;
-		GraphBLAS::MxV<MinPlusSemiring>(At, distances, distances);
-	} while (oldDist != distances);
+	// expand the frontier of the last level into the unvisited nodes; with edge weights, a visited node can still
+	// improve, so every node whose distance changed is part of the next frontier
+	SparseVector frontier(n, MinPlusSemiring::zero());
+	frontier.insert(source, 0);
+	while (!frontier.isEmpty()) {
+		if (weighted) {
+			frontier = GraphBLAS::MxSpV<MinPlusSemiring>(At, A, frontier, distances);
+		} else {
+			frontier = GraphBLAS::MxSpV<MinPlusSemiring>(At, A, frontier, distances, [&](index i) {
+				return distances[i] == std::numeric_limits<double>::infinity();
+			});
+		}
+	}
 
 	hasRun = true;
 }
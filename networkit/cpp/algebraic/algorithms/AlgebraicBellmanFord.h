@@ -28,7 +28,7 @@ public:
 	 * @param graph
 	 * @param source
 	 */
-	AlgebraicBellmanFord(const Graph& graph, node source) : At(Matrix::adjacencyMatrix(graph, MinPlusSemiring::zero()).transpose()), source(source), negCycle(false) {}
+	AlgebraicBellmanFord(const Graph& graph, node source) : A(Matrix::adjacencyMatrix(graph, MinPlusSemiring::zero())), At(A.transpose()), source(source), negCycle(false) {}
 
 	/** Default destructor */
 	~AlgebraicBellmanFord() = default;
@@ -58,6 +58,7 @@ public:
 	}
 
 private:
+	const Matrix A;
 	const Matrix At;
 	node source;
 	Vector distances;
@@ -70,13 +71,17 @@ void AlgebraicBellmanFord<Matrix>::run() {
 	distances = Vector(n, std::numeric_limits<double>::infinity());
 	distances[source] = 0;
 
-	for (index k = 1; k < n; ++k) {
-		GraphBLAS::MxV<MinPlusSemiring>(At, distances, distances);
+	// only nodes whose distance changed in the last round can improve their neighbors
+	SparseVector changed(n, MinPlusSemiring::zero());
+	changed.insert(source, 0);
+	for (index k = 1; k < n && !changed.isEmpty(); ++k) {
+		changed = GraphBLAS::MxSpV<MinPlusSemiring>(At, A, changed, distances);
 	}
 
-	Vector oldDist = distances;
-	GraphBLAS::MxV<MinPlusSemiring>(At, distances, distances);
-	negCycle = (oldDist != distances);
+	if (!changed.isEmpty()) {
+		changed = GraphBLAS::MxSpV<MinPlusSemiring>(At, A, changed, distances);
+	}
+	negCycle = !changed.isEmpty();
 	hasRun = true;
 }
 
@@ -9,6 +9,9 @@
 
 #include "../../CSRMatrix.h"
 #include "../../../graph/BFS.h"
+#include "../../../graph/Dijkstra.h"
+#include "../../../generators/ErdosRenyiGenerator.h"
+#include "../../../auxiliary/Random.h"
 #include "../AlgebraicBFS.h"
 #include "../../../io/METISGraphReader.h"
 
@@ -63,6 +66,45 @@ TEST(AlgebraicBFSGTest, testOnToyGraph) {
 	EXPECT_EQ(3, bfs.distance(6));
 }
 
+TEST(AlgebraicBFSGTest, testAgainstBFS) {
+	METISGraphReader reader;
+	for (std::string graph : {"input/PGPgiantcompo.graph", "input/power.graph"}) {
+		Graph G = reader.read(graph);
+		BFS bfs(G, 0, false);
+		bfs.run();
+
+		AlgebraicBFS<CSRMatrix> algebraicBfs(G, 0);
+		algebraicBfs.run();
+
+		G.forNodes([&](node u) {
+			EXPECT_EQ(bfs.distance(u), algebraicBfs.distance(u));
+		});
+	}
+}
+
+TEST(AlgebraicBFSGTest, testWeightedAgainstDijkstra) {
+	Aux::Random::setSeed(42, false);
+	for (bool directed : {false, true}) {
+		Graph G(ErdosRenyiGenerator(500, 0.01, directed).generate(), true, directed);
+		G.forEdges([&](node u, node v) {
+			G.setWeight(u, v, Aux::Random::integer(1, 10));
+		});
+		Dijkstra dijkstra(G, 0, false);
+		dijkstra.run();
+
+		AlgebraicBFS<CSRMatrix> algebraicBfs(G, 0);
+		algebraicBfs.run();
+
+		G.forNodes([&](node u) {
+			if (dijkstra.distance(u) == std::numeric_limits<edgeweight>::max()) {
+				EXPECT_EQ(std::numeric_limits<double>::infinity(), algebraicBfs.distance(u));
+			} else {
+				EXPECT_EQ(dijkstra.distance(u), algebraicBfs.distance(u)) << "node " << u;
+			}
+		});
+	}
+}
+
 TEST(AlgebraicBFSGTest, benchmarkBFS) {
 	METISGraphReader reader;
 	Graph G = reader.read("input/caidaRouterLevel.graph");
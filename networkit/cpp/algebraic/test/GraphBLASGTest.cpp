@@ -7,6 +7,8 @@
 
 #include "GraphBLASGTest.h"
 #include "../CSRMatrix.h"
+#include "../DynamicMatrix.h"
+#include "../../io/METISGraphReader.h"
 #include <iostream>
 namespace NetworKit {
 
@@ -169,6 +171,60 @@ TEST_F(GraphBLASGTest, testMxMAccum) {
 	EXPECT_EQ(17, C(3,3));
 }
 
+TEST_F(GraphBLASGTest, testMxMOnLargeMatrices) {
+	METISGraphReader reader;
+	Graph G = reader.read("input/PGPgiantcompo.graph");
+	CSRMatrix A = CSRMatrix::adjacencyMatrix(G);
+
+	CSRMatrix result = GraphBLAS::MxM(A, A);
+	EXPECT_TRUE(result.sorted());
+
+	// (A*A)(u,v) is the number of common neighbors of u and v
+	std::vector<count> common(G.upperNodeIdBound(), 0);
+	G.forNodes([&](node u) {
+		G.forNeighborsOf(u, [&](node w) {
+			G.forNeighborsOf(w, [&](node v) {
+				common[v]++;
+			});
+		});
+
+		count nnz = 0;
+		G.forNodes([&](node v) {
+			if (common[v] > 0) {
+				EXPECT_EQ(common[v], result(u,v));
+				nnz++;
+			}
+			common[v] = 0;
+		});
+		EXPECT_EQ(nnz, result.nnzInRow(u));
+	});
+
+	// other matrix types and rectangular matrices
+	std::vector<Triplet> triplets;
+	std::vector<Triplet> triplets2;
+	A.forNonZeroElementsInRowOrder([&](index i, index j, double value) {
+		triplets.push_back({i, j % 7, value});
+		if (i < 7) triplets2.push_back({i, j, value});
+	});
+
+	DynamicMatrix D1(A.numberOfRows(), 7, triplets);
+	DynamicMatrix D2(7, A.numberOfColumns(), triplets2);
+	CSRMatrix C1(A.numberOfRows(), 7, triplets);
+	CSRMatrix C2(7, A.numberOfColumns(), triplets2);
+
+	DynamicMatrix D = GraphBLAS::MxM(D1, D2);
+	CSRMatrix C = GraphBLAS::MxM(C1, C2);
+	CSRMatrix reference = C1 * C2;
+	ASSERT_EQ(A.numberOfRows(), D.numberOfRows());
+	ASSERT_EQ(A.numberOfColumns(), D.numberOfColumns());
+	EXPECT_EQ(C.nnz(), D.nnz());
+	EXPECT_EQ(C.nnz(), reference.nnz());
+	C.forNonZeroElementsInRowOrder([&](index i, index j, double value) {
+		EXPECT_EQ(value, D(i,j));
+		EXPECT_EQ(value, reference(i,j));
+	});
+}
+
 TEST_F(GraphBLASGTest, testMxV) {
 	std::vector<Triplet> triplets;
 
@@ -223,6 +279,45 @@ TEST_F(GraphBLASGTest, testMxV) {
 	EXPECT_EQ(2, res[3]);
 }
 
+TEST_F(GraphBLASGTest, testMxSpV) {
+	METISGraphReader reader;
+	Graph G = reader.read("input/PGPgiantcompo.graph");
+	CSRMatrix A = CSRMatrix::adjacencyMatrix(G);
+	CSRMatrix At = A.transpose();
+	const count n = A.numberOfRows();
+
+	// a single entry is pushed, half of all entries are pulled
+	for (count numEntries : {(count) 1, n / 2}) {
+		SparseVector x(n);
+		for (index i = 0; i < numEntries; ++i) {
+			x.insert(2 * i, i + 1.0);
+		}
+
+		Vector expected = GraphBLAS::MxV(A, x.toDense());
+		Vector c(n, 0.0);
+		SparseVector changed = GraphBLAS::MxSpV(A, At, x, c);
+		for (index i = 0; i < n; ++i) {
+			EXPECT_EQ(expected[i], c[i]);
+		}
+
+		count numChanged = 0;
+		for (index i = 0; i < n; ++i) {
+			if (expected[i] != 0) numChanged++;
+		}
+		EXPECT_EQ(numChanged, changed.nnz());
+		changed.forElements([&](index i, double value) {
+			EXPECT_EQ(expected[i], value);
+		});
+
+		// odd entries are masked
+		c = Vector(n, 0.0);
+		GraphBLAS::MxSpV(A, At, x, c, [](index i) {return i % 2 == 0;});
+		for (index i = 0; i < n; ++i) {
+			EXPECT_EQ(i % 2 == 0 ? expected[i] : 0.0, c[i]);
+		}
+	}
+}
+
 TEST_F(GraphBLASGTest, testEWiseAdd) {
 	std::vector<Triplet> triplets1;
 	std::vector<Triplet> triplets2;
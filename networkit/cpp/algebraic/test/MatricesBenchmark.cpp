@@ -0,0 +1,74 @@
+/*
+ * MatricesBenchmark.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef NOGTEST
+
+#include "MatricesBenchmark.h"
+
+#include "../CSRMatrix.h"
+#include "../SellCSigmaMatrix.h"
+#include "../../generators/BarabasiAlbertGenerator.h"
+#include "../../io/METISGraphReader.h"
+#include "../../auxiliary/Random.h"
+#include "../../auxiliary/Timer.h"
+#include "../../auxiliary/Log.h"
+
+namespace NetworKit {
+
+namespace {
+
+/**
+ * Runs @a iterations matrix-vector products with @a matrix and reports the throughput.
+ */
+template<class Matrix>
+Vector benchmarkSpMV(const Matrix& matrix, const Vector& x, count iterations, const std::string& name) {
+	Vector result = matrix * x; // warm up
+	Aux::Timer timer;
+	timer.start();
+	for (index i = 0; i < iterations; ++i) {
+		result = matrix * x;
+	}
+	timer.stop();
+
+	double seconds = timer.elapsedMicroseconds() / 1e6;
+	INFO(name, ": ", timer.elapsedMilliseconds(), " ms for ", iterations, " products, ", 2.0 * matrix.nnz() * iterations / seconds / 1e9, " GFLOP/s");
+	return result;
+}
+
+void compareSpMV(const Graph& G, const std::string& graphName) {
+	const count iterations = 100;
+	CSRMatrix csr = CSRMatrix::laplacianMatrix(G);
+	Vector x(csr.numberOfColumns());
+	for (index i = 0; i < x.getDimension(); ++i) {
+		x[i] = Aux::Random::real(-1.0, 1.0);
+	}
+
+	INFO(graphName, ": n = ", csr.numberOfRows(), ", nnz = ", csr.nnz());
+	Vector expected = benchmarkSpMV(csr, x, iterations, "CSR");
+
+	for (count sigma : {SellCSigmaMatrix::chunkHeight, SellCSigmaMatrix::defaultSigma, 4096 * SellCSigmaMatrix::chunkHeight}) {
+		SellCSigmaMatrix sell(csr, sigma);
+		INFO("SELL-", SellCSigmaMatrix::chunkHeight, "-", sell.getSigma(), " stores ", sell.storedElements(), " elements");
+		Vector result = benchmarkSpMV(sell, x, iterations, "SELL-C-sigma");
+		EXPECT_LE((result - expected).length(), 1e-9 * expected.length());
+	}
+}
+
+} // namespace
+
+TEST_F(MatricesBenchmark, benchmarkSpMVOnLaplacians) {
+	METISGraphReader reader;
+	compareSpMV(reader.read("input/PGPgiantcompo.graph"), "PGPgiantcompo");
+	compareSpMV(reader.read("input/astro-ph.graph"), "astro-ph");
+
+	BarabasiAlbertGenerator gen(10, 200000);
+	compareSpMV(gen.generate(), "BarabasiAlbert");
+}
+
+} /* namespace NetworKit */
+
+#endif /* NOGTEST */
@@ -0,0 +1,27 @@
+/*
+ * MatricesBenchmark.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef NOGTEST
+
+#ifndef NETWORKIT_CPP_ALGEBRAIC_TEST_MATRICESBENCHMARK_H_
+#define NETWORKIT_CPP_ALGEBRAIC_TEST_MATRICESBENCHMARK_H_
+
+#include <gtest/gtest.h>
+
+namespace NetworKit {
+
+class MatricesBenchmark : public testing::Test {
+public:
+	MatricesBenchmark() = default;
+	virtual ~MatricesBenchmark() = default;
+};
+
+} /* namespace NetworKit */
+
+#endif /* NETWORKIT_CPP_ALGEBRAIC_TEST_MATRICESBENCHMARK_H_ */
+
+#endif /* NOGTEST */
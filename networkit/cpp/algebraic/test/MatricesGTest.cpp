@@ -10,30 +10,35 @@
 #include "../CSRMatrix.h"
 #include "../DenseMatrix.h"
 #include "../DynamicMatrix.h"
+#include "../SellCSigmaMatrix.h"
 
 namespace NetworKit {
 
 TEST_F(MatricesGTest, testDimension) {
 	testDimension<DynamicMatrix>();
 	testDimension<CSRMatrix>();
+	testDimension<SellCSigmaMatrix>();
 	testDimension<DenseMatrix>();
 }
 
 TEST_F(MatricesGTest, testNNZInRow) {
 	testNNZInRow<DynamicMatrix>();
 	testNNZInRow<CSRMatrix>();
+	testNNZInRow<SellCSigmaMatrix>();
 	testNNZInRow<DenseMatrix>();
 }
 
 TEST_F(MatricesGTest, testRowAndColumnAccess) {
 	testRowAndColumnAccess<DynamicMatrix>();
 	testRowAndColumnAccess<CSRMatrix>();
+	testRowAndColumnAccess<SellCSigmaMatrix>();
 	testRowAndColumnAccess<DenseMatrix>();
 }
 
 TEST_F(MatricesGTest, testDiagonalVector) {
 	testDiagonalVector<DynamicMatrix>();
 	testDiagonalVector<CSRMatrix>();
+	testDiagonalVector<SellCSigmaMatrix>();
 	testDiagonalVector<DenseMatrix>();
 }
 
@@ -86,6 +91,7 @@ TEST_F(MatricesGTest, testMatrixDivisionOperator) {
 TEST_F(MatricesGTest, testMatrixVectorProduct) {
 	testMatrixVectorProduct<DynamicMatrix>();
 	testMatrixVectorProduct<CSRMatrix>();
+	testMatrixVectorProduct<SellCSigmaMatrix>();
 	testMatrixVectorProduct<DenseMatrix>();
 }
 
@@ -118,6 +124,54 @@ TEST_F(MatricesGTest, testIncidenceMatrix) {
 TEST_F(MatricesGTest, testLaplacianMatrixOfGraph) {
 	testLaplacianOfGraph<DynamicMatrix>();
 	testLaplacianOfGraph<CSRMatrix>();
+	testLaplacianOfGraph<SellCSigmaMatrix>();
+}
+
+TEST_F(MatricesGTest, testSellCSigmaMatchesCSR) {
+	CSRMatrix csr = CSRMatrix::laplacianMatrix(graph);
+	Vector x(csr.numberOfColumns());
+	for (index i = 0; i < x.getDimension(); ++i) {
+		x[i] = Aux::Random::real(-1.0, 1.0);
+	}
+	Vector expected = csr * x;
+
+	for (count sigma : {(count) 1, SellCSigmaMatrix::chunkHeight, SellCSigmaMatrix::defaultSigma, csr.numberOfRows()}) {
+		SellCSigmaMatrix sell(csr, sigma);
+		EXPECT_EQ(0u, sell.getSigma() % SellCSigmaMatrix::chunkHeight);
+		EXPECT_EQ(csr.nnz(), sell.nnz());
+		EXPECT_GE(sell.storedElements(), sell.nnz());
+		EXPECT_TRUE(MatrixTools::isLaplacian(sell));
+
+		Vector result = sell * x;
+		ASSERT_EQ(expected.getDimension(), result.getDimension());
+		for (index i = 0; i < result.getDimension(); ++i) {
+			EXPECT_NEAR(expected[i], result[i], 1e-9);
+		}
+
+		for (index i = 0; i < csr.numberOfRows(); ++i) {
+			ASSERT_EQ(csr.nnzInRow(i), sell.nnzInRow(i));
+			sell.forNonZeroElementsInRow(i, [&](index j, double value) {
+				EXPECT_EQ(csr(i,j), value);
+			});
+		}
+
+		EXPECT_TRUE(csr == sell.toCSRMatrix());
+	}
+
+	// rectangular matrix with empty rows
+	std::vector<Triplet> triplets = {{0,1,1.0}, {0,4,2.0}, {2,3,-1.0}, {9,0,5.0}};
+	SellCSigmaMatrix rect(10, 5, triplets);
+	Vector result = rect * Vector({1,2,3,4,5});
+	EXPECT_EQ(12, result[0]);
+	EXPECT_EQ(0, result[1]);
+	EXPECT_EQ(-4, result[2]);
+	EXPECT_EQ(5, result[9]);
+
+	SellCSigmaMatrix rectT = rect.transpose();
+	EXPECT_EQ(5u, rectT.numberOfRows());
+	EXPECT_EQ(10u, rectT.numberOfColumns());
+	EXPECT_EQ(2.0, rectT(4,0));
+	EXPECT_EQ(5.0, rectT(0,9));
 }
 
 } /* namespace NetworKit */
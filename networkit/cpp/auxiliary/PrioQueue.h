@@ -8,6 +8,7 @@
 #ifndef PRIOQUEUE_H_
 #define PRIOQUEUE_H_
 
+#include <algorithm>
 #include <cassert>
 #include <set>
 #include <vector>
@@ -21,17 +22,28 @@ namespace Aux {
 /**
  * Priority queue with extract-min and decrease-key.
  * The type Val takes on integer values between 0 and n-1.
- * O(n log n) for construction, O(log n) for typical operations.
+ * Implemented as an addressable d-ary heap: a position index per value
+ * allows decrease-key without searching, and all elements live in one
+ * contiguous array, so no operation allocates once the queue is built.
+ * O(n) for construction, O(log n) for typical operations.
+ * Ties between equal keys are broken by the smaller value.
  */
 template<class Key, class Val>
 class PrioQueue {
 	typedef std::pair<Key, Val> ElemType;
 
 private:
-	std::set<ElemType> pqset;
-	std::vector<Key> mapValToKey;
+	static constexpr uint64_t arity = 4;
+	static constexpr uint64_t notInHeap = std::numeric_limits<uint64_t>::max();
 
-	const Key undefined = std::numeric_limits<Key>::max(); // TODO: make static
+	std::vector<ElemType> heap;
+	std::vector<uint64_t> position; // index of each value in heap, notInHeap if absent
+
+	void ensureValue(Val value);
+	void place(uint64_t pos, const ElemType& elem);
+	void siftUp(uint64_t pos);
+	void siftDown(uint64_t pos);
+	void buildHeap();
 
 public:
 	/**
@@ -55,6 +67,7 @@ public:
 
 	/**
 	 * Inserts key-value pair stored in @a elem.
+	 * If @a value is already present, its key is changed to @a key.
 	 */
 	virtual void insert(Key key, Val value);
 
@@ -100,9 +113,9 @@ public:
 	 * DEBUGGING
 	 */
 	virtual void print() {
-		DEBUG("num entries: ", mapValToKey.size());
-		for (uint64_t i = 0; i < mapValToKey.size(); ++i) {
-			DEBUG("key: ", mapValToKey[i], ", val: ", i, "\n");
+		DEBUG("num entries: ", heap.size());
+		for (uint64_t i = 0; i < heap.size(); ++i) {
+			DEBUG("key: ", heap[i].first, ", val: ", heap[i].second, "\n");
 		}
 	}
 };
@@ -110,37 +123,115 @@ public:
 } /* namespace Aux */
 
 template<class Key, class Val>
-Aux::PrioQueue<Key, Val>::PrioQueue(const std::vector<ElemType>& elems) {
-	mapValToKey.resize(elems.size());
+constexpr uint64_t Aux::PrioQueue<Key, Val>::arity;
+
+template<class Key, class Val>
+constexpr uint64_t Aux::PrioQueue<Key, Val>::notInHeap;
+
+template<class Key, class Val>
+Aux::PrioQueue<Key, Val>::PrioQueue(const std::vector<ElemType>& elems) : position(elems.size(), notInHeap) {
+	heap.reserve(elems.size());
 	for (auto elem: elems) {
-		insert(elem.first, elem.second);
+		ensureValue(elem.second);
+		if (position[elem.second] == notInHeap) {
+			position[elem.second] = heap.size();
+			heap.push_back(elem);
+		} else {
+			heap[position[elem.second]].first = elem.first;
+		}
 	}
+	buildHeap();
 }
 
 template<class Key, class Val>
-Aux::PrioQueue<Key, Val>::PrioQueue(std::vector<Key>& keys) {
-	mapValToKey.resize(keys.size());
+Aux::PrioQueue<Key, Val>::PrioQueue(std::vector<Key>& keys) : position(keys.size()) {
+	heap.reserve(keys.size());
 	uint64_t index = 0;
 	for (auto key: keys) {
-		insert(key, index);
+		position[index] = index;
+		heap.emplace_back(key, index);
 		++index;
 	}
+	buildHeap();
 }
 
 template<class Key, class Val>
-Aux::PrioQueue<Key, Val>::PrioQueue(uint64_t len) {
-	mapValToKey.resize(len);
+Aux::PrioQueue<Key, Val>::PrioQueue(uint64_t len) : position(len, notInHeap) {
+	heap.reserve(len);
+}
+
+template<class Key, class Val>
+inline void Aux::PrioQueue<Key, Val>::ensureValue(Val value) {
+	if (value >= position.size()) {
+		position.resize(std::max<uint64_t>(2 * position.size(), value + 1), notInHeap);
+	}
+}
+
+template<class Key, class Val>
+inline void Aux::PrioQueue<Key, Val>::place(uint64_t pos, const ElemType& elem) {
+	heap[pos] = elem;
+	position[elem.second] = pos;
+}
+
+template<class Key, class Val>
+inline void Aux::PrioQueue<Key, Val>::siftUp(uint64_t pos) {
+	ElemType elem = heap[pos];
+	while (pos > 0) {
+		uint64_t parent = (pos - 1) / arity;
+		if (!(elem < heap[parent])) {
+			break;
+		}
+		place(pos, heap[parent]);
+		pos = parent;
+	}
+	place(pos, elem);
+}
+
+template<class Key, class Val>
+inline void Aux::PrioQueue<Key, Val>::siftDown(uint64_t pos) {
+	ElemType elem = heap[pos];
+	const uint64_t n = heap.size();
+	while (true) {
+		uint64_t first = arity * pos + 1;
+		if (first >= n) {
+			break;
+		}
+		uint64_t last = std::min(first + arity, n);
+		uint64_t minChild = first;
+		for (uint64_t child = first + 1; child < last; ++child) {
+			if (heap[child] < heap[minChild]) {
+				minChild = child;
+			}
+		}
+		if (!(heap[minChild] < elem)) {
+			break;
+		}
+		place(pos, heap[minChild]);
+		pos = minChild;
+	}
+	place(pos, elem);
+}
+
+template<class Key, class Val>
+void Aux::PrioQueue<Key, Val>::buildHeap() {
+	if (heap.size() < 2) {
+		return;
+	}
+	for (uint64_t pos = (heap.size() - 2) / arity + 1; pos > 0; --pos) {
+		siftDown(pos - 1);
+	}
 }
 
 template<class Key, class Val>
 inline void Aux::PrioQueue<Key, Val>::insert(Key key, Val value) {
-	if (value >= mapValToKey.size()) {
-		uint64_t doubledSize = 2 * mapValToKey.size();
-		assert(value < doubledSize);
-		mapValToKey.resize(doubledSize);
+	ensureValue(value);
+	if (position[value] != notInHeap) {
+		decreaseKey(key, value);
+		return;
 	}
-	pqset.insert(std::make_pair(key, value));
-	mapValToKey.at(value) = key;
+	position[value] = heap.size();
+	heap.emplace_back(key, value);
+	siftUp(heap.size() - 1);
 }
 
 template<class Key, class Val>
@@ -150,43 +241,73 @@ inline void Aux::PrioQueue<Key, Val>::remove(const ElemType& elem) {
 
 template<class Key, class Val>
 inline void Aux::PrioQueue<Key, Val>::remove(const Val& val) {
-	Key key = mapValToKey.at(val);
-//	DEBUG("key: ", key);
-	pqset.erase(std::make_pair(key, val));
-	mapValToKey.at(val) = undefined;
+	if (val >= position.size() || position[val] == notInHeap) {
+		return;
+	}
+	uint64_t pos = position[val];
+	position[val] = notInHeap;
+	ElemType last = heap.back();
+	heap.pop_back();
+	if (pos == heap.size()) {
+		return;
+	}
+	// move the last element into the gap and restore the heap property in either direction
+	bool up = last < heap[pos];
+	place(pos, last);
+	if (up) {
+		siftUp(pos);
+	} else {
+		siftDown(pos);
+	}
 }
 
 template<class Key, class Val>
 std::pair<Key, Val> Aux::PrioQueue<Key, Val>::extractMin() {
-	assert(pqset.size() > 0);
-	ElemType elem = (* pqset.begin());
-	remove(elem);
+	assert(heap.size() > 0);
+	ElemType elem = heap.front();
+	position[elem.second] = notInHeap;
+	ElemType last = heap.back();
+	heap.pop_back();
+	if (!heap.empty()) {
+		place(0, last);
+		siftDown(0);
+	}
 	return elem;
 }
 
 template<class Key, class Val>
 inline void Aux::PrioQueue<Key, Val>::decreaseKey(Key newKey, Val value) {
-	// find and remove element with given key
-	remove(value);
-
-	// insert element with new value
-	insert(newKey, value);
+	ensureValue(value);
+	uint64_t pos = position[value];
+	if (pos == notInHeap) {
+		insert(newKey, value);
+		return;
+	}
+	// callers may also raise the key, so sift in whichever direction is needed
+	ElemType elem(newKey, value);
+	bool up = elem < heap[pos];
+	heap[pos] = elem;
+	if (up) {
+		siftUp(pos);
+	} else {
+		siftDown(pos);
+	}
 }
 
 template<class Key, class Val>
 inline uint64_t Aux::PrioQueue<Key, Val>::size() const {
-	return pqset.size();
+	return heap.size();
 }
 
 template<class Key, class Val>
 inline std::set<std::pair<Key, Val>> Aux::PrioQueue<Key, Val>::content() const {
-	return pqset;
+	return std::set<std::pair<Key, Val>>(heap.begin(), heap.end());
 }
 
 template<class Key, class Val>
 inline void Aux::PrioQueue<Key, Val>::clear() {
-	pqset.clear();
-	mapValToKey.clear();
+	heap.clear();
+	position.clear();
 }
 
 
@@ -217,6 +217,58 @@ TEST_F(AuxGTest, testPriorityQueue) {
 	EXPECT_EQ(pq.size(), vec.size() - 5);
 }
 
+TEST_F(AuxGTest, testPriorityQueueAgainstSet) {
+	typedef std::pair<double, uint64_t> ElemType;
+	Aux::Random::setSeed(42, false);
+	const uint64_t n = 500;
+
+	// random operations, compared against a std::set with the same tie-breaking
+	Aux::PrioQueue<double, uint64_t> pq(10);
+	std::set<ElemType> reference;
+	std::vector<double> keyOf(n, -1.0);
+	for (uint64_t i = 0; i < 20000; ++i) {
+		uint64_t value = Aux::Random::integer(n - 1);
+		double key = Aux::Random::integer(100);
+		switch (Aux::Random::integer(3)) {
+		case 0:
+		case 1:
+			pq.decreaseKey(key, value);
+			if (keyOf[value] >= 0) {
+				reference.erase(std::make_pair(keyOf[value], value));
+			}
+			reference.insert(std::make_pair(key, value));
+			keyOf[value] = key;
+			break;
+		case 2:
+			pq.remove(value);
+			if (keyOf[value] >= 0) {
+				reference.erase(std::make_pair(keyOf[value], value));
+				keyOf[value] = -1.0;
+			}
+			break;
+		default:
+			if (!reference.empty()) {
+				ElemType elem = pq.extractMin();
+				EXPECT_EQ(*reference.begin(), elem);
+				reference.erase(reference.begin());
+				keyOf[elem.second] = -1.0;
+			}
+		}
+		ASSERT_EQ(reference.size(), pq.size());
+	}
+	EXPECT_EQ(reference, pq.content());
+
+	while (pq.size() > 0) {
+		EXPECT_EQ(*reference.begin(), pq.extractMin());
+		reference.erase(reference.begin());
+	}
+
+	pq.clear();
+	pq.insert(1.0, 7);
+	pq.insert(0.5, 3);
+	EXPECT_EQ(ElemType(0.5, 3), pq.extractMin());
+}
+
 TEST_F(AuxGTest, testPrioQueueForInts) {
 	// fill vector with priorities
 	std::vector<uint64_t> vec;
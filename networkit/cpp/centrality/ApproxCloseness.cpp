@@ -7,6 +7,8 @@
 
 #include "ApproxCloseness.h"
 #include "../auxiliary/PrioQueue.h"
+#include "../graph/DirOptBFS.h"
+#include <algorithm>
 #include <cassert>
 #include <queue>
 
@@ -17,7 +19,7 @@ typedef struct ListEntry_struct {
 	edgeweight dist_val;
 } ListEntry;
 
-ApproxCloseness::ApproxCloseness(const Graph& G, count nSamples, double epsilon, bool normalized, CLOSENESS_TYPE type) : Centrality(G, normalized), nSamples(nSamples), epsilon(epsilon), type(type) {
+ApproxCloseness::ApproxCloseness(const Graph& G, count nSamples, double epsilon, bool normalized, CLOSENESS_TYPE type, bool parallelBFS) : Centrality(G, normalized), nSamples(nSamples), epsilon(epsilon), type(type), parallelBFS(parallelBFS) {
 	assert(nSamples > 0 && nSamples <= G.numberOfNodes() && epsilon >= 0);
 }
 
@@ -385,6 +387,14 @@ void ApproxCloseness::orderNodesByIncreasingDistance(node c, std::vector<node> &
 		}
 
 		assert(idx == G.numberOfNodes());
+	} else if (parallelBFS) { // the BFS stack lists the nodes level by level
+		DirOptBFS bfs(G, c, false, true);
+		bfs.run();
+		std::vector<node> stack = bfs.getStack();
+		std::copy(stack.begin(), stack.end(), order.begin());
+		for (node u : stack) {
+			pivotDist[u] = bfs.distance(u);
+		}
 	} else { // use BFS to compute distance from pivot and the respective order
 		std::queue<node> q;
 		q.push(c);
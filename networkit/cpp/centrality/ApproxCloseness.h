@@ -34,8 +34,9 @@ public:
 	 * @param 	epsilon		Value in [0, infty) controlling the switch between sampling and pivoting. When using 0, only sampling is used. Standard is 0.1.
 	 * @param	normalized  normalize centrality values in interval [0,1]
 	 * @param 	type		use in- or outbound centrality or the sum of both (see paper) for computing closeness on directed graph. If G is undirected, this can be ignored.
+	 * @param	parallelBFS	on unweighted graphs, order the nodes by their distance to a pivot with the parallel direction-optimizing DirOptBFS
 	 */
-	ApproxCloseness(const Graph& G, count nSamples, double epsilon = 0.1, bool normalized=false, CLOSENESS_TYPE type = OUTBOUND);
+	ApproxCloseness(const Graph& G, count nSamples, double epsilon = 0.1, bool normalized=false, CLOSENESS_TYPE type = OUTBOUND, bool parallelBFS = false);
 
 
 	/**
@@ -86,6 +87,7 @@ private:
 	const edgeweight infDist = floor(std::numeric_limits<edgeweight>::max() / 2.0); // divided by two s.t. infDist + infDist produces no overflow
 
 	CLOSENESS_TYPE type;
+	bool parallelBFS;
 
 	void estimateClosenessForUndirectedGraph();
 	void estimateClosenessForDirectedGraph(bool outbound);
@@ -8,6 +8,7 @@
 #include <stack>
 #include <queue>
 #include <memory>
+#include <cmath>
 #include <omp.h>
 
 
@@ -21,6 +22,42 @@
 
 namespace NetworKit {
 
+namespace {
+
+/**
+ * Per-thread state of the exact betweenness computation. All entries are
+ * reset after each source by walking the stack, so a source costs time
+ * proportional to the part of the graph it reaches.
+ */
+struct BetweennessWorkspace {
+	std::vector<edgeweight> dist;
+	std::vector<double> sigma;		// number of shortest paths from the source
+	std::vector<double> dependency;
+	std::vector<node> stack;		// reached nodes in order of nondecreasing distance
+	std::unique_ptr<Aux::PrioQueue<edgeweight, node>> pq;
+
+	void init(count z, bool weighted) {
+		dist.assign(z, std::numeric_limits<edgeweight>::max());
+		sigma.assign(z, 0.0);
+		dependency.assign(z, 0.0);
+		stack.reserve(z);
+		if (weighted) {
+			pq.reset(new Aux::PrioQueue<edgeweight, node>(z));
+		}
+	}
+
+	void reset() {
+		for (node u : stack) {
+			dist[u] = std::numeric_limits<edgeweight>::max();
+			sigma[u] = 0.0;
+			dependency[u] = 0.0;
+		}
+		stack.clear();
+	}
+};
+
+} /* anonymous namespace */
+
 Betweenness::Betweenness(const Graph& G, bool normalized, bool computeEdgeCentrality) : Centrality(G, normalized, computeEdgeCentrality) {
 
 }
@@ -47,7 +84,8 @@ void Betweenness::run() {
 	}
 	DEBUG("edge score per thread: ", edgeScorePerThread.size());
 
-	auto computeDependencies = [&](node s) {
+	// reference implementation with arbitrary precision path counts, used when the double counts overflow
+	auto computeDependenciesExact = [&](node s) {
 
 		std::vector<double> dependency(z, 0.0);
 
@@ -84,6 +122,86 @@ void Betweenness::run() {
 			}
 		}
 	};
+	std::vector<BetweennessWorkspace> workspaces(maxThreads);
+
+	auto computeDependencies = [&](node s) {
+		BetweennessWorkspace& ws = workspaces[omp_get_thread_num()];
+		if (ws.dist.size() != z) {
+			ws.init(z, G.isWeighted());
+		}
+		if (!handler.isRunning()) return;
+
+		// forward pass: distances and path counts, predecessors are implied by dist[p] + w == dist[t]
+		bool overflow = false;
+		ws.dist[s] = 0;
+		ws.sigma[s] = 1;
+		if (G.isWeighted()) {
+			ws.pq->insert(0, s);
+			while (ws.pq->size() > 0) {
+				node u = ws.pq->extractMin().second;
+				ws.stack.push_back(u);
+				G.forEdgesOf(u, [&](node u, node v, edgeweight w) {
+					edgeweight d = ws.dist[u] + w;
+					if (d < ws.dist[v]) {
+						ws.dist[v] = d;
+						ws.sigma[v] = ws.sigma[u];
+						ws.pq->decreaseKey(d, v);
+					} else if (d == ws.dist[v]) {
+						ws.sigma[v] += ws.sigma[u];
+						overflow |= std::isinf(ws.sigma[v]);
+					}
+				});
+			}
+		} else {
+			// the stack doubles as the BFS queue
+			ws.stack.push_back(s);
+			for (index head = 0; head < ws.stack.size(); ++head) {
+				node u = ws.stack[head];
+				G.forNeighborsOf(u, [&](node v) {
+					if (ws.dist[v] == std::numeric_limits<edgeweight>::max()) {
+						ws.dist[v] = ws.dist[u] + 1;
+						ws.stack.push_back(v);
+					}
+					if (ws.dist[v] == ws.dist[u] + 1) {
+						ws.sigma[v] += ws.sigma[u];
+						overflow |= std::isinf(ws.sigma[v]);
+					}
+				});
+			}
+		}
+
+		if (overflow) {
+			ws.reset();
+			computeDependenciesExact(s);
+			return;
+		}
+		if (!handler.isRunning()) {
+			ws.reset();
+			return;
+		}
+
+		// backward pass in order of decreasing distance from s
+		auto& score = scorePerThread[omp_get_thread_num()];
+		for (auto it = ws.stack.rbegin(); it != ws.stack.rend(); ++it) {
+			node t = *it;
+			double factor = (1 + ws.dependency[t]) / ws.sigma[t];
+			// unweighted graphs report weight 1, matching the BFS distances
+			G.forInEdgesOf(t, [&](node, node p, edgeweight w, edgeid eid) {
+				if (ws.dist[p] != std::numeric_limits<edgeweight>::max() && ws.dist[p] + w == ws.dist[t]) {
+					double c = ws.sigma[p] * factor;
+					ws.dependency[p] += c;
+					if (computeEdgeCentrality) {
+						edgeScorePerThread[omp_get_thread_num()][eid] += c;
+					}
+				}
+			});
+			if (t != s) {
+				score[t] += ws.dependency[t];
+			}
+		}
+		ws.reset();
+	};
+
 	handler.assureRunning();
 	G.balancedParallelForNodes(computeDependencies);
 	handler.assureRunning();
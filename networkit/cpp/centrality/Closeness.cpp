@@ -15,6 +15,7 @@
 #include "../graph/SSSP.h"
 #include "../graph/Dijkstra.h"
 #include "../graph/BFS.h"
+#include "../graph/MultiSourceBFS.h"
 #include "../components/ConnectedComponents.h"
 
 
@@ -37,26 +38,46 @@ void Closeness::run() {
 	scoreData.resize(z);
 	edgeweight infDist = std::numeric_limits<edgeweight>::max();
 
-	G.parallelForNodes([&](node s) {
-		std::unique_ptr<SSSP> sssp;
-		if (G.isWeighted()) {
-			sssp.reset(new Dijkstra(G, s, true, true));
-		} else {
-			sssp.reset(new BFS(G, s, true, true));
-		}
-		sssp->run();
+	if (G.isWeighted()) {
+		G.parallelForNodes([&](node s) {
+			Dijkstra sssp(G, s, false, false);
+			sssp.run();
 
-		std::vector<edgeweight> distances = sssp->getDistances();
+			std::vector<edgeweight> distances = sssp.getDistances();
 
-		double sum = 0;
-		for (auto dist : distances) {
-			if (dist != infDist ) {
-				sum += dist;
+			double sum = 0;
+			for (auto dist : distances) {
+				if (dist != infDist ) {
+					sum += dist;
+				}
 			}
-		}
-		scoreData[s] = 1 / sum;
+			scoreData[s] = 1 / sum;
 
-	});
+		});
+	} else {
+		// batches of 64 sources share their traversals, sum[i] accumulates the distances from sources[i]
+		std::vector<node> nodes = G.nodes();
+		const count batchSize = MultiSourceBFS::maxSources;
+		const count numberOfBatches = (nodes.size() + batchSize - 1) / batchSize;
+		#pragma omp parallel
+		{
+			MultiSourceBFS msbfs(G);
+			#pragma omp for schedule(dynamic, 1)
+			for (index batch = 0; batch < numberOfBatches; ++batch) {
+				auto first = nodes.begin() + batch * batchSize;
+				std::vector<node> sources(first, nodes.begin() + std::min((batch + 1) * batchSize, (count) nodes.size()));
+				std::vector<double> sum(sources.size(), 0.0);
+				msbfs.run(sources, [&](node, count dist, uint64_t newSources) {
+					MultiSourceBFS::forSources(newSources, [&](index i) {
+						sum[i] += dist;
+					});
+				});
+				for (index i = 0; i < sources.size(); ++i) {
+					scoreData[sources[i]] = 1 / sum[i];
+				}
+			}
+		}
+	}
 	if (normalized) {
 		G.forNodes([&](node u){
 			scoreData[u] = scoreData[u] * (G.numberOfNodes() - 1);
@@ -15,11 +15,11 @@
 
 namespace NetworKit {
 
-CoreDecomposition::CoreDecomposition(const Graph& G, bool normalized, bool enforceBucketQueueAlgorithm) :
-		Centrality(G, normalized), maxCore(0), enforceBucketQueueAlgorithm(enforceBucketQueueAlgorithm)
+CoreDecomposition::CoreDecomposition(const Graph& G, bool normalized, bool enforceBucketQueueAlgorithm, bool storeNodeOrder) :
+		Centrality(G, normalized), maxCore(0), enforceBucketQueueAlgorithm(enforceBucketQueueAlgorithm || storeNodeOrder), storeNodeOrder(storeNodeOrder)
 {
 	if (G.numberOfSelfLoops()) throw std::runtime_error("Core Decomposition implementation does not support graphs with self-loops. Call Graph.removeSelfLoops() first.");
-	canRunInParallel = (! enforceBucketQueueAlgorithm && (G.numberOfNodes() == G.upperNodeIdBound()));
+	canRunInParallel = (! this->enforceBucketQueueAlgorithm && (G.numberOfNodes() == G.upperNodeIdBound()));
 }
 
 void CoreDecomposition::run() {
@@ -271,9 +271,20 @@ void CoreDecomposition::runWithBucketQueues() {
 
 	maxCore = core;
 
+	/* The queue now holds the nodes in the order they were removed. */
+	if (storeNodeOrder) {
+		nodeOrder = std::move(queue);
+	}
+
 	hasRun = true;
 }
 
+const std::vector<node>& CoreDecomposition::getNodeOrder() const {
+	if (! hasRun) throw std::runtime_error("call run method first");
+	if (! storeNodeOrder) throw std::runtime_error("the node order has not been stored");
+	return nodeOrder;
+}
+
 
 Cover CoreDecomposition::getCover() const {
 	if (! hasRun) throw std::runtime_error("call run method first");
@@ -35,8 +35,11 @@ public:
 	 * Dasari, N.S.; Desh, R.; Zubair, M., "ParK: An efficient algorithm for k-core decomposition on multicore processors," in Big Data (Big Data), * 2014 IEEE International Conference on , vol., no., pp.9-16, 27-30 Oct. 2014 doi: 10.1109/BigData.2014.7004366
 	 *
 	 * @param G The graph.
+	 * @param normalized Divide each core number by the maximum degree.
+	 * @param enforceBucketQueueAlgorithm Use the sequential bucket queue algorithm instead of ParK.
+	 * @param storeNodeOrder Store the order in which the nodes are removed, implies the bucket queue algorithm.
 	 */
-	CoreDecomposition(const Graph& G, bool normalized=false, bool enforceBucketQueueAlgorithm = false);
+	CoreDecomposition(const Graph& G, bool normalized=false, bool enforceBucketQueueAlgorithm = false, bool storeNodeOrder = false);
 
 	/**
 	 * Perform k-core decomposition of graph passed in constructor.
@@ -64,6 +67,14 @@ public:
 	 */
 	index maxCoreNumber() const;
 
+	/**
+	 * Get the nodes in the order in which they were removed (a degeneracy order): each node has at most as many
+	 * neighbors after it in the order as its core number. Only available if the node order was stored.
+	 *
+	 * @return The nodes sorted by removal time
+	 */
+	const std::vector<node>& getNodeOrder() const;
+
 	/**
 	* Get the theoretical maximum of centrality score in the given graph.
 	*
@@ -87,6 +98,10 @@ private:
 
 	bool canRunInParallel; // signifies if a parallel algorithm can be used
 
+	bool storeNodeOrder; // store the removal order of the nodes
+
+	std::vector<node> nodeOrder; // removal order of the nodes, only with storeNodeOrder
+
 	/**
 	 * Perform k-core decomposition of graph passed in constructor.
 	 * ParK is an algorithm by Naga Shailaja Dasari, Ranjan Desh, and Zubair M.
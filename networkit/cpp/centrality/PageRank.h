@@ -23,6 +23,7 @@ class PageRank: public NetworKit::Centrality {
 protected:
 	double damp;
 	double tol;
+	bool gaussSeidel;
 
 public:
 	/**
@@ -31,8 +32,9 @@ public:
 	 * @param[in] G Graph to be processed.
 	 * @param[in] damp Damping factor of the PageRank algorithm.
 	 * @param[in] tol Error tolerance for PageRank iteration.
+	 * @param[in] gaussSeidel Use Gauss-Seidel sweeps within blocks of nodes instead of Jacobi sweeps.
 	 */
-	PageRank(const Graph& G, double damp=0.85, double tol = 1e-8);
+	PageRank(const Graph& G, double damp=0.85, double tol = 1e-8, bool gaussSeidel = false);
 
 	virtual void run();
 
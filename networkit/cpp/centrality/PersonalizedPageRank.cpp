@@ -0,0 +1,209 @@
+/*
+ * PersonalizedPageRank.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: NetworKit contributors
+ */
+
+#include "PersonalizedPageRank.h"
+#include "../auxiliary/NumericTools.h"
+#include "../auxiliary/SignalHandling.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace NetworKit {
+
+PersonalizedPageRank::PersonalizedPageRank(const Graph& G, const std::vector<std::vector<node>>& seeds, double damp, double tol, bool gaussSeidel) :
+		G(G), seeds(seeds), damp(damp), tol(tol), gaussSeidel(gaussSeidel), iterations(0) {
+	for (const auto& seedSet : seeds) {
+		if (seedSet.empty()) {
+			throw std::runtime_error("PersonalizedPageRank: each seed set must contain at least one node");
+		}
+		for (node u : seedSet) {
+			if (!G.hasNode(u)) {
+				throw std::runtime_error("PersonalizedPageRank: seed node is not in the graph");
+			}
+		}
+	}
+}
+
+void PersonalizedPageRank::run() {
+	Aux::SignalHandler handler;
+	const count z = G.upperNodeIdBound();
+	const count k = seeds.size();
+
+	// in-edges in CSR format, the weight of (v, u) is pre-scaled by damp / weightedDegree(v)
+	std::vector<double> scale(z, 0.0);
+	std::vector<index> inOffsets(z + 1, 0);
+	G.parallelForNodes([&](node u) {
+		double deg = G.weightedDegree(u);
+		scale[u] = deg != 0.0 ? damp / deg : 0.0;
+		inOffsets[u + 1] = G.degreeIn(u);
+	});
+	for (index u = 0; u < z; ++u) {
+		inOffsets[u + 1] += inOffsets[u];
+	}
+
+	std::vector<node> sources(inOffsets[z]);
+	std::vector<double> weights(inOffsets[z]);
+	G.balancedParallelForNodes([&](node u) {
+		index e = inOffsets[u];
+		G.forInEdgesOf(u, [&](node u, node v, edgeweight w) {
+			// note: inconsistency in definition in Newman's book (Ch. 7) regarding directed graphs
+			// we follow the verbal description, which requires to sum over the incoming edges
+			sources[e] = v;
+			weights[e] = w * scale[v];
+			++e;
+		});
+	});
+
+	// teleport vectors and initial scores: the uniform distribution on each seed set
+	std::vector<double> teleport(z * k, 0.0);
+	scoreData.assign(z * k, 0.0);
+	for (index s = 0; s < k; ++s) {
+		const double p = 1.0 / (double) seeds[s].size();
+		for (node u : seeds[s]) {
+			teleport[u * k + s] += (1.0 - damp) * p;
+			scoreData[u * k + s] += p;
+		}
+	}
+	std::vector<double> next(z * k, 0.0);
+
+	// blocks of nodes with roughly the same number of in-edges; a Gauss-Seidel sweep stays within a block.
+	// The blocks do not depend on the number of threads, so scores and iteration counts are reproducible.
+	const count numBlocks = std::min<count>(z, 64);
+	std::vector<index> blockBegin(numBlocks + 1, z);
+	const count work = z + inOffsets[z];
+	for (index b = 0; b < numBlocks; ++b) {
+		index lo = 0, hi = z;
+		const count target = b * work / numBlocks;
+		while (lo < hi) {
+			index mid = (lo + hi) / 2;
+			if (inOffsets[mid] + mid < target) {
+				lo = mid + 1;
+			} else {
+				hi = mid;
+			}
+		}
+		blockBegin[b] = lo;
+	}
+
+	iterations = 0;
+	bool isConverged = (z == 0);
+	while (!isConverged) {
+		handler.assureRunning();
+		// squared change per block and seed set, summed up in block order below
+		std::vector<double> blockDiff(numBlocks * k, 0.0);
+
+#pragma omp parallel
+		{
+			std::vector<double> acc(k);
+
+#pragma omp for schedule(dynamic)
+			for (index b = 0; b < numBlocks; ++b) {
+				const index begin = blockBegin[b];
+				double *localDiff = &blockDiff[b * k];
+				for (index u = begin; u < blockBegin[b + 1]; ++u) {
+					std::copy(teleport.begin() + u * k, teleport.begin() + (u + 1) * k, acc.begin());
+					for (index e = inOffsets[u]; e < inOffsets[u + 1]; ++e) {
+						const node v = sources[e];
+						const double w = weights[e];
+						const double *contrib = (gaussSeidel && v >= begin && v < u) ? &next[v * k] : &scoreData[v * k];
+#pragma omp simd
+						for (index s = 0; s < k; ++s) {
+							acc[s] += w * contrib[s];
+						}
+					}
+
+					for (index s = 0; s < k; ++s) {
+						double d = acc[s] - scoreData[u * k + s];
+						localDiff[s] += d * d;
+						next[u * k + s] = acc[s];
+					}
+				}
+			}
+		}
+
+		std::vector<double> diff(k, 0.0);
+		for (index b = 0; b < numBlocks; ++b) {
+			for (index s = 0; s < k; ++s) {
+				diff[s] += blockDiff[b * k + s];
+			}
+		}
+
+		std::swap(scoreData, next);
+		++iterations;
+		isConverged = std::all_of(diff.begin(), diff.end(), [&](double d) {
+			return std::sqrt(d) <= tol;
+		});
+	}
+	handler.assureRunning();
+
+	// make sure each score vector sums up to 1
+	std::vector<double> sum(k, 0.0);
+	G.forNodes([&](node u) {
+		for (index s = 0; s < k; ++s) {
+			sum[s] += scoreData[u * k + s];
+		}
+	});
+	for (index s = 0; s < k; ++s) {
+		assert(!Aux::NumericTools::equal(sum[s], 0.0, 1e-15));
+	}
+	G.parallelForNodes([&](node u) {
+		for (index s = 0; s < k; ++s) {
+			scoreData[u * k + s] /= sum[s];
+		}
+	});
+
+	hasRun = true;
+}
+
+std::vector<double> PersonalizedPageRank::scores(index s) const {
+	if (!hasRun) {
+		throw std::runtime_error("Call run method first");
+	}
+	if (s >= seeds.size()) {
+		throw std::runtime_error("PersonalizedPageRank: seed set index out of range");
+	}
+
+	const count k = seeds.size();
+	std::vector<double> result(G.upperNodeIdBound());
+	for (node u = 0; u < result.size(); ++u) {
+		result[u] = scoreData[u * k + s];
+	}
+
+	return result;
+}
+
+double PersonalizedPageRank::score(index s, node u) const {
+	if (!hasRun) {
+		throw std::runtime_error("Call run method first");
+	}
+	if (s >= seeds.size()) {
+		throw std::runtime_error("PersonalizedPageRank: seed set index out of range");
+	}
+	if (u >= G.upperNodeIdBound()) {
+		throw std::runtime_error("PersonalizedPageRank: node out of range");
+	}
+
+	return scoreData[u * seeds.size() + s];
+}
+
+count PersonalizedPageRank::numberOfIterations() const {
+	if (!hasRun) {
+		throw std::runtime_error("Call run method first");
+	}
+
+	return iterations;
+}
+
+std::string PersonalizedPageRank::toString() const {
+	return "PersonalizedPageRank";
+}
+
+bool PersonalizedPageRank::isParallel() const {
+	return true;
+}
+
+} /* namespace NetworKit */
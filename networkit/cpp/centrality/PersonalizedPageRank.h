@@ -0,0 +1,79 @@
+/*
+ * PersonalizedPageRank.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef PERSONALIZEDPAGERANK_H_
+#define PERSONALIZEDPAGERANK_H_
+
+#include <vector>
+#include "../base/Algorithm.h"
+#include "../graph/Graph.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup centrality
+ * Computes personalized PageRank for several seed sets at once. The random surfer of seed set s teleports to a
+ * uniformly chosen node of s instead of an arbitrary node of the graph. All score vectors are iterated together so
+ * that each sweep reads the in-edges of a node once for all seed sets.
+ *
+ * The in-edges are stored once in CSR format with weights pre-scaled by damp / weightedDegree(source), so one sweep
+ * is a pure multiply-add over the edges. The score vectors are stored interleaved by node and two buffers are swapped
+ * between sweeps. With @a gaussSeidel, each thread uses the scores it has already updated in the current sweep for
+ * sources within its own block of nodes, which usually saves iterations. The blocks depend only on the graph, so the
+ * results do not depend on the number of threads.
+ */
+class PersonalizedPageRank: public Algorithm {
+public:
+	/**
+	 * Constructs the PersonalizedPageRank class for the Graph @a G and the seed sets @a seeds.
+	 *
+	 * @param[in] G Graph to be processed.
+	 * @param[in] seeds One non-empty seed set per score vector.
+	 * @param[in] damp Damping factor of the PageRank algorithm.
+	 * @param[in] tol Error tolerance (L2 norm of the change per sweep) for each score vector.
+	 * @param[in] gaussSeidel Use Gauss-Seidel sweeps within blocks of nodes instead of Jacobi sweeps.
+	 */
+	PersonalizedPageRank(const Graph& G, const std::vector<std::vector<node>>& seeds, double damp = 0.85, double tol = 1e-8, bool gaussSeidel = false);
+
+	/**
+	 * Computes the score vectors of all seed sets.
+	 */
+	void run() override;
+
+	/**
+	 * @return The personalized PageRank scores of seed set @a s. Each score vector sums up to 1.
+	 * Throws std::runtime_error if @a s is not a seed set index.
+	 */
+	std::vector<double> scores(index s) const;
+
+	/**
+	 * @return The personalized PageRank score of node @a u for seed set @a s.
+	 * Throws std::runtime_error if @a s is not a seed set index or @a u is not below upperNodeIdBound().
+	 */
+	double score(index s, node u) const;
+
+	/**
+	 * @return The number of sweeps needed until all score vectors converged.
+	 */
+	count numberOfIterations() const;
+
+	std::string toString() const override;
+
+	bool isParallel() const override;
+
+protected:
+	const Graph& G;
+	std::vector<std::vector<node>> seeds;
+	double damp;
+	double tol;
+	bool gaussSeidel;
+	count iterations;
+	std::vector<double> scoreData; // score of node u for seed set s at u * seeds.size() + s
+};
+
+} /* namespace NetworKit */
+#endif /* PERSONALIZEDPAGERANK_H_ */
@@ -72,12 +72,13 @@ void SpanningEdgeCentrality::runApproximation() {
 	double epsilon2 = tol * tol;
 	const count k = ceil(log2(n)) / epsilon2;
 	double randTab[3] = {1/sqrt(k), -1/sqrt(k)};
-	Vector solution(n);
+	std::vector<Vector> rhs;
+	std::vector<Vector> solutions;
 	scoreData.clear();
 	scoreData.resize(m, 0.0);
 
 	for (index i = 0; i < k; ++i) {
-		Vector rhs(n, 0.0);
+		rhs.emplace_back(n, 0.0);
 
 		// rhs(v) = \sum_e=1 ^m q(e) * B(e, v)
 		//        = +/- q(e)
@@ -85,21 +86,28 @@ void SpanningEdgeCentrality::runApproximation() {
 			double r = randTab[Aux::Random::integer(1)];
 
 			if (u < v) {
-				rhs[u] += r;
-				rhs[v] -= r;
+				rhs.back()[u] += r;
+				rhs.back()[v] -= r;
 			}
 			else {
-				rhs[u] -= r;
-				rhs[v] += r;
+				rhs.back()[u] -= r;
+				rhs.back()[v] += r;
 			}
 		});
 
-		lamg.solve(rhs, solution);
+		// solve the right-hand sides in blocks of SOLVE_BLOCK_SIZE
+		if (rhs.size() == SOLVE_BLOCK_SIZE || i + 1 == k) {
+			solutions.assign(rhs.size(), Vector(n));
+			lamg.solveBlock(rhs, solutions);
 
-		G.forEdges([&](node u, node v, edgeid e) {
-			double diff = solution[u] - solution[v];
-			scoreData[e] += diff * diff; // TODO: fix weighted case!
-		});
+			for (const Vector& solution : solutions) {
+				G.forEdges([&](node u, node v, edgeid e) {
+					double diff = solution[u] - solution[v];
+					scoreData[e] += diff * diff; // TODO: fix weighted case!
+				});
+			}
+			rhs.clear();
+		}
 	}
 
 	hasRun = true;
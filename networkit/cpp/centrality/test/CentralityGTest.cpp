@@ -16,6 +16,7 @@
 #include "../EigenvectorCentrality.h"
 #include "../KatzCentrality.h"
 #include "../PageRank.h"
+#include "../PersonalizedPageRank.h"
 #include "../KPathCentrality.h"
 #include "../CoreDecomposition.h"
 #include "../LocalClusteringCoefficient.h"
@@ -30,8 +31,11 @@
 #include "../../generators/ErdosRenyiGenerator.h"
 #include "../../generators/DorogovtsevMendesGenerator.h"
 #include "../TopCloseness.h"
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <iomanip>
+#include <omp.h>
 
 
 
@@ -69,6 +73,37 @@ TEST_F(CentralityGTest, testBetweennessCentrality) {
 }
 
 
+TEST_F(CentralityGTest, testBetweennessPathCountOverflow) {
+	// a chain of k diamonds between hubs 0..k has 2^k shortest paths end to end,
+	// which overflows double path counts for k > 1023
+	count k = 1100;
+	Graph G(3 * k + 1);
+	for (index i = 0; i < k; ++i) {
+		node left = i;
+		node right = i + 1;
+		node a = k + 1 + 2 * i;
+		node b = a + 1;
+		G.addEdge(left, a);
+		G.addEdge(left, b);
+		G.addEdge(a, right);
+		G.addEdge(b, right);
+	}
+
+	Betweenness centrality(G);
+	centrality.run();
+	std::vector<double> bc = centrality.scores();
+
+	// every pair separated by an inner hub passes through it, in both directions;
+	// the middle nodes of each adjacent diamond add half of their two paths
+	for (index i : {1, 100, 550, 1099}) {
+		double expected = 2.0 * (3 * i) * (3 * (k - i)) + 2.0;
+		EXPECT_NEAR(expected, bc[i], 1e-9 * expected) << "hub " << i;
+	}
+	G.forNodes([&](node u) {
+		EXPECT_TRUE(std::isfinite(bc[u])) << "node " << u;
+	});
+}
+
 TEST_F(CentralityGTest, testBetweenness2Centrality) {
 /* Graph:
 	0    3
@@ -282,6 +317,124 @@ TEST_F(CentralityGTest, testPageRankCentrality) {
 	EXPECT_NEAR(0.0565, fabs(cen[7]), tol);
 }
 
+TEST_F(CentralityGTest, testPageRankGaussSeidel) {
+	METISGraphReader reader;
+	Graph G = reader.read("input/PGPgiantcompo.graph");
+
+	PageRank jacobi(G, 0.85, 1e-10);
+	jacobi.run();
+	PageRank gaussSeidel(G, 0.85, 1e-10, true);
+	gaussSeidel.run();
+
+	G.forNodes([&](node u) {
+		EXPECT_NEAR(jacobi.score(u), gaussSeidel.score(u), 1e-8);
+	});
+}
+
+/**
+ * Reference personalized PageRank by the power iteration PageRank used before it was based on PersonalizedPageRank.
+ */
+static std::vector<double> referencePageRank(const Graph& G, const std::vector<node>& seeds, double damp) {
+	const count z = G.upperNodeIdBound();
+	std::vector<double> teleport(z, 0.0), scores(z, 0.0), next(z, 0.0);
+	for (node u : seeds) {
+		teleport[u] += 1.0 / (double) seeds.size();
+		scores[u] += 1.0 / (double) seeds.size();
+	}
+
+	double diff = 1.0;
+	for (count iter = 0; iter < 1000 && diff > 1e-15; ++iter) {
+		G.forNodes([&](node u) {
+			next[u] = 0.0;
+			G.forInEdgesOf(u, [&](node u, node v, edgeweight w) {
+				next[u] += scores[v] * w / G.weightedDegree(v);
+			});
+			next[u] = damp * next[u] + (1.0 - damp) * teleport[u];
+		});
+		diff = 0.0;
+		G.forNodes([&](node u) {
+			diff += std::fabs(next[u] - scores[u]);
+		});
+		std::swap(scores, next);
+	}
+
+	double sum = G.parallelSumForNodes([&](node u) {
+		return scores[u];
+	});
+	G.forNodes([&](node u) {
+		scores[u] /= sum;
+	});
+	return scores;
+}
+
+TEST_F(CentralityGTest, testPersonalizedPageRank) {
+	METISGraphReader reader;
+	Graph G = reader.read("input/PGPgiantcompo.graph");
+	const double damp = 0.85;
+	const double tol = 1e-10;
+
+	std::vector<std::vector<node>> seeds;
+	for (index s = 0; s < 12; ++s) {
+		std::vector<node> seedSet;
+		for (index i = 0; i <= s % 3; ++i) {
+			seedSet.push_back(G.randomNode());
+		}
+		seeds.push_back(seedSet);
+	}
+
+	for (bool gaussSeidel : {false, true}) {
+		PersonalizedPageRank batched(G, seeds, damp, tol, gaussSeidel);
+		batched.run();
+
+		for (index s = 0; s < seeds.size(); ++s) {
+			PersonalizedPageRank single(G, {seeds[s]}, damp, tol);
+			single.run();
+			std::vector<double> scores = batched.scores(s);
+			std::vector<double> reference = referencePageRank(G, seeds[s], damp);
+
+			double sum = 0.0;
+			G.forNodes([&](node u) {
+				EXPECT_NEAR(single.score(0, u), scores[u], 1e-8);
+				EXPECT_NEAR(reference[u], scores[u], 1e-8);
+				sum += scores[u];
+			});
+			EXPECT_NEAR(1.0, sum, 1e-9);
+		}
+	}
+
+	// with all nodes as seeds, the reference is PageRank
+	std::vector<node> nodes;
+	G.forNodes([&](node u) {
+		nodes.push_back(u);
+	});
+	std::vector<double> reference = referencePageRank(G, nodes, damp);
+	for (bool gaussSeidel : {false, true}) {
+		PageRank pr(G, damp, tol, gaussSeidel);
+		pr.run();
+		G.forNodes([&](node u) {
+			EXPECT_NEAR(reference[u], pr.score(u), 1e-8);
+		});
+	}
+
+	// the Gauss-Seidel blocks do not depend on the number of threads
+	int threads = omp_get_max_threads();
+	omp_set_num_threads(1);
+	PersonalizedPageRank sequential(G, seeds, damp, tol, true);
+	sequential.run();
+	omp_set_num_threads(std::max(threads, 4));
+	PersonalizedPageRank parallel(G, seeds, damp, tol, true);
+	parallel.run();
+	omp_set_num_threads(threads);
+	EXPECT_EQ(sequential.numberOfIterations(), parallel.numberOfIterations());
+	for (index s = 0; s < seeds.size(); ++s) {
+		EXPECT_EQ(sequential.scores(s), parallel.scores(s));
+	}
+
+	EXPECT_THROW(parallel.scores(seeds.size()), std::runtime_error);
+	EXPECT_THROW(parallel.score(seeds.size(), 0), std::runtime_error);
+	EXPECT_THROW(parallel.score(0, G.upperNodeIdBound()), std::runtime_error);
+}
+
 TEST_F(CentralityGTest, benchSequentialBetweennessCentralityOnRealGraph) {
 	METISGraphReader reader;
 	Graph G = reader.read("input/celegans_metabolic.graph");
@@ -0,0 +1,432 @@
+/*
+ * BitsetMaxClique.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: NetworKit contributors
+ */
+
+#include "BitsetMaxClique.h"
+#include "../centrality/CoreDecomposition.h"
+#include "../auxiliary/SignalHandling.h"
+
+#include <algorithm>
+
+namespace NetworKit {
+
+namespace {
+
+typedef uint64_t word;
+constexpr count wordBits = 64;
+
+inline count numberOfWords(count bits) {
+	return (bits + wordBits - 1) / wordBits;
+}
+
+inline void setBit(word* set, index i) {
+	set[i / wordBits] |= word(1) << (i % wordBits);
+}
+
+inline void clearBit(word* set, index i) {
+	set[i / wordBits] &= ~(word(1) << (i % wordBits));
+}
+
+inline bool isEmpty(const word* set, count words) {
+	for (index w = 0; w < words; ++w) {
+		if (set[w]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+inline count popcount(const word* set, count words) {
+	count result = 0;
+	for (index w = 0; w < words; ++w) {
+		result += __builtin_popcountll(set[w]);
+	}
+	return result;
+}
+
+inline count popcountAnd(const word* a, const word* b, count words) {
+	count result = 0;
+	for (index w = 0; w < words; ++w) {
+		result += __builtin_popcountll(a[w] & b[w]);
+	}
+	return result;
+}
+
+/**
+ * Calls @a handle(i) for each set bit i of @a set in increasing order; @a set may be changed at or after bit i.
+ */
+template<typename L>
+inline void forBits(const word* set, count words, L handle) {
+	for (index w = 0; w < words; ++w) {
+		word bits = set[w];
+		while (bits) {
+			handle(w * wordBits + __builtin_ctzll(bits));
+			bits &= bits - 1;
+		}
+	}
+}
+
+} /* namespace */
+
+/**
+ * The subproblem of a root node: its neighbors later in the degeneracy order (the candidates) and, for the enumeration
+ * of maximal cliques, its neighbors earlier in the order (excluded), numbered locally with the candidates first.
+ */
+struct BitsetMaxClique::Subproblem {
+	node root;
+	std::vector<node> nodes; // local index -> node
+	count numCandidates;
+	count words; // words of a full row (candidates and excluded nodes)
+	count candidateWords; // words of a row restricted to the candidates
+	std::vector<word> adjacency; // full rows of the candidates, followed by the candidate rows of the excluded nodes
+
+	// buffers per recursion depth
+	std::vector<std::vector<word>> candidates;
+	std::vector<std::vector<word>> excluded;
+	std::vector<std::vector<word>> branch;
+	std::vector<std::vector<std::pair<index, count>>> colored;
+	std::vector<word> colorClass;
+	std::vector<word> uncolored;
+
+	const word* row(index a) const {
+		return a < numCandidates ? &adjacency[a * words] : &adjacency[numCandidates * words + (a - numCandidates) * candidateWords];
+	}
+
+	/**
+	 * Sets up the subproblem of @a v from its @a later neighbors and, if given, its @a earlier neighbors.
+	 * @a localIndex must be none for all nodes and is restored before returning.
+	 */
+	void build(const Graph& G, node v, const std::vector<node>& later, const std::vector<node>& earlier, std::vector<index>& localIndex) {
+		root = v;
+		nodes = later;
+		nodes.insert(nodes.end(), earlier.begin(), earlier.end());
+		numCandidates = later.size();
+		words = numberOfWords(nodes.size());
+		candidateWords = numberOfWords(numCandidates);
+
+		for (index a = 0; a < nodes.size(); ++a) {
+			localIndex[nodes[a]] = a;
+		}
+
+		adjacency.assign(numCandidates * words + earlier.size() * candidateWords, 0);
+		for (index a = 0; a < numCandidates; ++a) {
+			word* rowA = &adjacency[a * words];
+			G.forNeighborsOf(nodes[a], [&](node u) {
+				const index b = localIndex[u];
+				if (b == none || b == a) { // self-loops are no clique edges
+					return;
+				}
+				setBit(rowA, b);
+				if (b >= numCandidates) {
+					// by symmetry, this also fills the candidate part of the rows of the excluded nodes
+					setBit(&adjacency[numCandidates * words + (b - numCandidates) * candidateWords], a);
+				}
+			});
+		}
+
+		for (node u : nodes) {
+			localIndex[u] = none;
+		}
+
+		// a clique has at most numCandidates + 1 nodes, so the recursion is at most that deep
+		candidates.resize(numCandidates + 2);
+		excluded.resize(numCandidates + 2);
+		branch.resize(numCandidates + 2);
+		colored.resize(numCandidates + 2);
+		colorClass.resize(words);
+		uncolored.resize(words);
+
+		candidates[0].assign(words, 0);
+		for (index a = 0; a < numCandidates; ++a) {
+			setBit(candidates[0].data(), a);
+		}
+		excluded[0].assign(words, 0);
+		for (index a = numCandidates; a < nodes.size(); ++a) {
+			setBit(excluded[0].data(), a);
+		}
+	}
+};
+
+BitsetMaxClique::BitsetMaxClique(const Graph& G, count lb) : G(G), lb(lb), best(lb) {
+	if (G.isDirected()) {
+		throw std::runtime_error("BitsetMaxClique is not implemented for directed graphs");
+	}
+}
+
+void BitsetMaxClique::orderNodes(std::vector<node>& order, std::vector<count>& core) const {
+	// the core decomposition rejects self-loops, they do not change any clique
+	Graph withoutSelfLoops;
+	if (G.numberOfSelfLoops() > 0) {
+		withoutSelfLoops = G;
+		withoutSelfLoops.removeSelfLoops();
+	}
+	CoreDecomposition coreDec(G.numberOfSelfLoops() > 0 ? withoutSelfLoops : G, false, false, true);
+	coreDec.run();
+	order = coreDec.getNodeOrder();
+
+	const std::vector<double> coreNumbers = coreDec.scores();
+	core.assign(G.upperNodeIdBound(), 0);
+	G.parallelForNodes([&](node u) {
+		core[u] = (count) coreNumbers[u];
+	});
+}
+
+void BitsetMaxClique::run() {
+	Aux::SignalHandler handler;
+	const count z = G.upperNodeIdBound();
+
+	std::vector<node> order;
+	std::vector<count> core;
+	orderNodes(order, core);
+	const count n = order.size();
+	std::vector<index> position(z, none);
+	for (index i = 0; i < n; ++i) {
+		position[order[i]] = i;
+	}
+
+	best = lb;
+	bestClique.clear();
+
+#pragma omp parallel
+	{
+		Subproblem sp;
+		std::vector<index> localIndex(z, none);
+		std::vector<node> later;
+		const std::vector<node> earlier;
+		std::vector<index> clique;
+
+		// the end of the order holds the densest cores, starting there raises the incumbent early
+#pragma omp for schedule(dynamic, 1)
+		for (index i = 0; i < n; ++i) {
+			const node v = order[n - 1 - i];
+			if (core[v] + 1 <= best.load(std::memory_order_relaxed) || !handler.isRunning()) {
+				continue;
+			}
+
+			later.clear();
+			G.forNeighborsOf(v, [&](node u) {
+				if (position[u] > position[v]) {
+					later.push_back(u);
+				}
+			});
+			if (later.size() + 1 <= best.load(std::memory_order_relaxed)) {
+				continue;
+			}
+
+			sp.build(G, v, later, earlier, localIndex);
+			clique.clear();
+			expand(sp, 0, clique);
+		}
+	}
+	handler.assureRunning();
+
+	std::sort(bestClique.begin(), bestClique.end());
+	hasRun = true;
+}
+
+void BitsetMaxClique::expand(Subproblem& sp, index depth, std::vector<index>& clique) {
+	const count words = sp.words;
+	word* P = sp.candidates[depth].data();
+	const count size = 1 + clique.size();
+
+	if (isEmpty(P, words)) {
+		if (size > best.load(std::memory_order_relaxed)) {
+#pragma omp critical(BitsetMaxCliqueBest)
+			if (size > best.load(std::memory_order_relaxed)) {
+				bestClique.assign(1, sp.root);
+				for (index a : clique) {
+					bestClique.push_back(sp.nodes[a]);
+				}
+				best.store(size, std::memory_order_relaxed);
+			}
+		}
+		return;
+	}
+
+	// greedy coloring by color classes of pairwise non-adjacent candidates; a candidate of color k extends the clique
+	// by at most k nodes, so candidates whose color cannot beat the incumbent are never branched on
+	const count incumbent = best.load(std::memory_order_relaxed);
+	const count minColor = incumbent >= size ? incumbent - size + 1 : 0;
+	std::vector<std::pair<index, count>>& colored = sp.colored[depth];
+	colored.clear();
+	word* U = sp.uncolored.data();
+	word* Q = sp.colorClass.data();
+	std::copy(P, P + words, U);
+	for (count color = 1; !isEmpty(U, words); ++color) {
+		std::copy(U, U + words, Q);
+		for (index w = 0; w < words;) {
+			if (!Q[w]) {
+				++w;
+				continue;
+			}
+			const index a = w * wordBits + __builtin_ctzll(Q[w]);
+			clearBit(U, a);
+			clearBit(Q, a);
+			const word* rowA = sp.row(a);
+			for (index j = w; j < words; ++j) {
+				Q[j] &= ~rowA[j];
+			}
+			if (color >= minColor) {
+				colored.emplace_back(a, color);
+			}
+		}
+	}
+
+	// branch on the candidates in decreasing order of color
+	std::vector<word>& next = sp.candidates[depth + 1];
+	next.resize(words);
+	for (index k = colored.size(); k-- > 0;) {
+		const index a = colored[k].first;
+		if (size + colored[k].second <= best.load(std::memory_order_relaxed)) {
+			return;
+		}
+
+		const word* rowA = sp.row(a);
+		for (index w = 0; w < words; ++w) {
+			next[w] = P[w] & rowA[w];
+		}
+		clique.push_back(a);
+		expand(sp, depth + 1, clique);
+		clique.pop_back();
+		clearBit(P, a);
+	}
+}
+
+void BitsetMaxClique::forMaximalCliques(std::function<void(const std::vector<node>&)> handle, count minSize) {
+	Aux::SignalHandler handler;
+	const count z = G.upperNodeIdBound();
+
+	std::vector<node> order;
+	std::vector<count> core;
+	orderNodes(order, core);
+	const count n = order.size();
+	std::vector<index> position(z, none);
+	for (index i = 0; i < n; ++i) {
+		position[order[i]] = i;
+	}
+
+	// each maximal clique is reported at its first node in the order, with the earlier neighbors as excluded nodes
+#pragma omp parallel
+	{
+		Subproblem sp;
+		std::vector<index> localIndex(z, none);
+		std::vector<node> later, earlier;
+		std::vector<index> clique;
+
+#pragma omp for schedule(dynamic, 1)
+		for (index i = 0; i < n; ++i) {
+			const node v = order[n - 1 - i];
+			if (core[v] + 1 < minSize || !handler.isRunning()) {
+				continue;
+			}
+
+			later.clear();
+			earlier.clear();
+			G.forNeighborsOf(v, [&](node u) {
+				if (position[u] > position[v]) {
+					later.push_back(u);
+				} else if (u != v) {
+					earlier.push_back(u);
+				}
+			});
+			if (later.size() + 1 < minSize) {
+				continue;
+			}
+
+			sp.build(G, v, later, earlier, localIndex);
+			clique.clear();
+			enumerate(sp, 0, clique, minSize, handle);
+		}
+	}
+	handler.assureRunning();
+}
+
+void BitsetMaxClique::enumerate(Subproblem& sp, index depth, std::vector<index>& clique, count minSize, std::function<void(const std::vector<node>&)>& handle) {
+	const count words = sp.words;
+	const count candidateWords = sp.candidateWords;
+	word* P = sp.candidates[depth].data();
+	word* X = sp.excluded[depth].data();
+
+	if (isEmpty(P, candidateWords)) {
+		if (isEmpty(X, words) && 1 + clique.size() >= minSize) {
+			std::vector<node> result(1, sp.root);
+			for (index a : clique) {
+				result.push_back(sp.nodes[a]);
+			}
+#pragma omp critical(BitsetMaxCliqueHandle)
+			handle(result);
+		}
+		return;
+	}
+	if (1 + clique.size() + popcount(P, candidateWords) < minSize) {
+		return;
+	}
+
+	// pivot: the node of P or X with the most neighbors in P; only its non-neighbors in P need to be branched on
+	index pivot = none;
+	count pivotDegree = 0;
+	auto considerPivot = [&](index a) {
+		const count degree = popcountAnd(P, sp.row(a), candidateWords);
+		if (pivot == none || degree > pivotDegree) {
+			pivot = a;
+			pivotDegree = degree;
+		}
+	};
+	forBits(P, candidateWords, considerPivot);
+	forBits(X, words, considerPivot);
+
+	std::vector<word>& B = sp.branch[depth];
+	B.resize(candidateWords);
+	const word* pivotRow = sp.row(pivot);
+	for (index w = 0; w < candidateWords; ++w) {
+		B[w] = P[w] & ~pivotRow[w];
+	}
+
+	std::vector<word>& nextP = sp.candidates[depth + 1];
+	std::vector<word>& nextX = sp.excluded[depth + 1];
+	nextP.assign(words, 0);
+	nextX.resize(words);
+	forBits(B.data(), candidateWords, [&](index a) {
+		const word* rowA = sp.row(a);
+		for (index w = 0; w < candidateWords; ++w) {
+			nextP[w] = P[w] & rowA[w];
+		}
+		for (index w = 0; w < words; ++w) {
+			nextX[w] = X[w] & rowA[w];
+		}
+		clique.push_back(a);
+		enumerate(sp, depth + 1, clique, minSize, handle);
+		clique.pop_back();
+		clearBit(P, a);
+		setBit(X, a);
+	});
+}
+
+count BitsetMaxClique::getMaxCliqueSize() const {
+	if (!hasRun) {
+		throw std::runtime_error("Call run method first");
+	}
+
+	return best;
+}
+
+std::vector<node> BitsetMaxClique::getMaxClique() const {
+	if (!hasRun) {
+		throw std::runtime_error("Call run method first");
+	}
+
+	return bestClique;
+}
+
+std::string BitsetMaxClique::toString() const {
+	return "BitsetMaxClique";
+}
+
+bool BitsetMaxClique::isParallel() const {
+	return true;
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,94 @@
+/*
+ * BitsetMaxClique.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef BITSETMAXCLIQUE_H_
+#define BITSETMAXCLIQUE_H_
+
+#include "../graph/Graph.h"
+#include "../base/Algorithm.h"
+
+#include <atomic>
+#include <functional>
+#include <vector>
+
+namespace NetworKit {
+
+/**
+ * @ingroup clique
+ * Exact branch-and-bound algorithm for the maximum clique of an undirected graph.
+ *
+ * The nodes are ordered by degeneracy (see CoreDecomposition). Each node v roots one subproblem whose candidates
+ * are the neighbors of v later in the order, so a subproblem has at most core(v) candidates and subproblems with
+ * core(v) + 1 not above the incumbent are skipped. Within a subproblem the candidates are numbered locally and the
+ * candidate sets and the adjacency are bitsets; each branching step greedily colors the candidates with word-wise
+ * operations and prunes by the number of colors (as in the BBMC algorithm by San Segundo et al.). The root subproblems
+ * are searched in parallel, from the densest end of the order on, and share an atomic incumbent size.
+ *
+ * forMaximalCliques() enumerates all maximal cliques with the Bron-Kerbosch algorithm with pivoting on the same
+ * subproblems and bitset kernels (Eppstein, Löffler and Strash).
+ *
+ * The graph must be undirected. Self-loops are ignored.
+ */
+class BitsetMaxClique : public Algorithm {
+public:
+	/**
+	 * Constructor for the maximum clique algorithm.
+	 * @param[in] G Graph @a G for which the algorithm should be run.
+	 * @param[in] lb Lower bound for the maximum clique size, only cliques larger than @a lb are searched.
+	 */
+	BitsetMaxClique(const Graph& G, count lb = 0);
+
+	/**
+	 * Computes a maximum clique.
+	 */
+	void run() override;
+
+	/**
+	 * @return Size of the maximum clique, or the lower bound if no larger clique exists.
+	 */
+	count getMaxCliqueSize() const;
+
+	/**
+	 * @return A maximum clique of the graph, sorted by node id. Empty if no clique larger than the lower bound exists.
+	 */
+	std::vector<node> getMaxClique() const;
+
+	/**
+	 * Calls @a handle for each maximal clique with at least @a minSize nodes. The root subproblems are enumerated in
+	 * parallel, but the calls of @a handle are serialized; their order is unspecified. Does not require run().
+	 *
+	 * @param[in] handle Receives each maximal clique as a vector of nodes.
+	 * @param[in] minSize Minimum size of the reported cliques.
+	 */
+	void forMaximalCliques(std::function<void(const std::vector<node>&)> handle, count minSize = 1);
+
+	std::string toString() const override;
+
+	bool isParallel() const override;
+
+protected:
+	const Graph& G;
+	count lb;
+	std::atomic<count> best;
+	std::vector<node> bestClique;
+
+private:
+	struct Subproblem;
+
+	/**
+	 * Computes the degeneracy order of the nodes and the core number of each node.
+	 */
+	void orderNodes(std::vector<node>& order, std::vector<count>& core) const;
+
+	void expand(Subproblem& sp, index depth, std::vector<index>& clique);
+
+	void enumerate(Subproblem& sp, index depth, std::vector<index>& clique, count minSize, std::function<void(const std::vector<node>&)>& handle);
+};
+
+} /* namespace NetworKit */
+
+#endif /* BITSETMAXCLIQUE_H_ */
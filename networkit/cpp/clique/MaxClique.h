@@ -18,7 +18,8 @@ namespace NetworKit {
 /**
  * Exact algorithm for computing the size of the largest clique in a graph.
  * Worst-case running time is exponential, but in practice the algorithm is fairly fast.
- * Reference: Pattabiraman et al., http://arxiv.org/pdf/1411.7460.pdf
+ * Runs the parallel bitset branch-and-bound of BitsetMaxClique, so the graph must be
+ * undirected; self-loops are ignored.
  */
 class MaxClique {
 protected:
@@ -26,12 +27,6 @@ protected:
 	count maxi;
 	std::unordered_set<node> bestClique;
 
-	/**
-	 * Subroutine that goes through every relevant clique containing a certain node in
-	 * a recursive fashion and computes the size of the largest.
-	 */
-	void clique(std::unordered_set<node>& U, std::unordered_set<node>& currClique, count size);
-
 public:
 	/**
 	 * Constructor for maximum clique algorithm.
@@ -41,10 +36,8 @@ public:
 	MaxClique(const Graph& G, count lb=0);
 
 	/**
-	 * Actual maximum clique algorithm. Determines largest clique each vertex
-	 * is contained in and returns size of largest. Pruning steps keep running time
-	 * acceptable in practice.
-	 * @return Size of maximum clique.
+	 * Actual maximum clique algorithm. Searches the subproblem of each vertex in
+	 * degeneracy order in parallel, bounded by greedy colorings.
 	 */
 	void run();
 
@@ -7,10 +7,15 @@
 
 #include "CliqueGTest.h"
 #include "../MaxClique.h"
+#include "../BitsetMaxClique.h"
 #include "../../io/METISGraphReader.h"
 #include "../../io/SNAPGraphReader.h"
 #include "../../auxiliary/Log.h"
 #include "../../io/EdgeListReader.h"
+#include "../../generators/ErdosRenyiGenerator.h"
+
+#include <algorithm>
+#include <set>
 
 
 namespace NetworKit {
@@ -55,5 +60,139 @@ TEST_F(CliqueGTest, testMaxCliqueOnSmallerGraphs) {
 	EXPECT_EQ(4u, cliqueHamming.size());
 }
 
+TEST_F(CliqueGTest, testBitsetMaxClique) {
+	EdgeListReader r(' ',1,"%");
+	Graph gJohnson = r.read("input/johnson8-4-4.edgelist");
+	Graph gHamming = r.read("input/hamming6-4.edgelist");
+	Graph gKeller = r.read("input/keller4.edgelist");
+
+	std::vector<std::pair<Graph*, count>> instances = {{&gJohnson, 14}, {&gHamming, 4}, {&gKeller, 11}};
+	for (auto instance : instances) {
+		const Graph& G = *instance.first;
+		BitsetMaxClique mc(G);
+		mc.run();
+		EXPECT_EQ(instance.second, mc.getMaxCliqueSize());
+
+		std::vector<node> clique = mc.getMaxClique();
+		ASSERT_EQ(instance.second, clique.size());
+		EXPECT_TRUE(std::is_sorted(clique.begin(), clique.end()));
+		for (node u : clique) {
+			for (node v : clique) {
+				EXPECT_TRUE(u == v || G.hasEdge(u, v));
+			}
+		}
+
+		// a lower bound that is already the optimum leaves nothing to find
+		BitsetMaxClique bounded(G, instance.second);
+		bounded.run();
+		EXPECT_EQ(instance.second, bounded.getMaxCliqueSize());
+		EXPECT_TRUE(bounded.getMaxClique().empty());
+	}
+}
+
+TEST_F(CliqueGTest, testMaximalCliques) {
+	// compare against all subsets of a small graph with deleted nodes
+	for (double p : {0.1, 0.4, 0.8}) {
+		Graph G = ErdosRenyiGenerator(14, p).generate();
+		G.addNode();
+		std::vector<node> neighbors;
+		G.forNeighborsOf(3, [&](node v) {
+			neighbors.push_back(v);
+		});
+		for (node v : neighbors) {
+			G.removeEdge(3, v);
+		}
+		G.removeNode(3);
+
+		std::set<std::vector<node>> expected;
+		count maxSize = 0;
+		const count z = G.upperNodeIdBound();
+		for (index subset = 1; subset < (index(1) << z); ++subset) {
+			std::vector<node> nodes;
+			bool valid = true;
+			for (node u = 0; u < z; ++u) {
+				if (subset & (index(1) << u)) {
+					valid = valid && G.hasNode(u);
+					nodes.push_back(u);
+				}
+			}
+			for (node u : nodes) {
+				for (node v : nodes) {
+					valid = valid && (u == v || G.hasEdge(u, v));
+				}
+			}
+			if (!valid) {
+				continue;
+			}
+
+			bool maximal = true;
+			G.forNodes([&](node w) {
+				if (!(subset & (index(1) << w)) && std::all_of(nodes.begin(), nodes.end(), [&](node u) { return G.hasEdge(u, w); })) {
+					maximal = false;
+				}
+			});
+			if (maximal) {
+				expected.insert(nodes);
+				maxSize = std::max(maxSize, (count) nodes.size());
+			}
+		}
+
+		BitsetMaxClique mc(G);
+		std::set<std::vector<node>> found;
+		count calls = 0;
+		mc.forMaximalCliques([&](const std::vector<node>& clique) {
+			std::vector<node> sorted = clique;
+			std::sort(sorted.begin(), sorted.end());
+			found.insert(sorted);
+			++calls;
+		});
+		EXPECT_EQ(expected, found);
+		EXPECT_EQ(expected.size(), calls);
+
+		count large = 0;
+		mc.forMaximalCliques([&](const std::vector<node>& clique) {
+			EXPECT_GE(clique.size(), 3u);
+			++large;
+		}, 3);
+		EXPECT_EQ((count) std::count_if(expected.begin(), expected.end(), [](const std::vector<node>& c) { return c.size() >= 3; }), large);
+
+		mc.run();
+		EXPECT_EQ(maxSize, mc.getMaxCliqueSize());
+	}
+}
+
+TEST_F(CliqueGTest, testMaxCliqueIgnoresSelfLoops) {
+	Graph G = ErdosRenyiGenerator(60, 0.3).generate();
+	Graph H = G;
+	for (node u = 0; u < H.upperNodeIdBound(); u += 3) {
+		H.addEdge(u, u);
+	}
+	ASSERT_GT(H.numberOfSelfLoops(), 0u);
+
+	MaxClique expected(G);
+	expected.run();
+	MaxClique mc(H);
+	mc.run();
+	EXPECT_EQ(expected.getMaxCliqueSize(), mc.getMaxCliqueSize());
+	EXPECT_EQ(mc.getMaxCliqueSize(), mc.getMaxClique().size());
+	for (node u : mc.getMaxClique()) {
+		for (node v : mc.getMaxClique()) {
+			EXPECT_TRUE(u == v || H.hasEdge(u, v));
+		}
+	}
+
+	std::set<std::vector<node>> cliquesG, cliquesH;
+	BitsetMaxClique(G).forMaximalCliques([&](const std::vector<node>& clique) {
+		std::vector<node> sorted = clique;
+		std::sort(sorted.begin(), sorted.end());
+		cliquesG.insert(sorted);
+	});
+	BitsetMaxClique(H).forMaximalCliques([&](const std::vector<node>& clique) {
+		std::vector<node> sorted = clique;
+		std::sort(sorted.begin(), sorted.end());
+		cliquesH.insert(sorted);
+	});
+	EXPECT_EQ(cliquesG, cliquesH);
+}
 
 } /* namespace NetworKit */
@@ -7,7 +7,9 @@
 
 #include "ParallelPartitionCoarsening.h"
 #include <omp.h>
+#include <atomic>
 #include "../graph/GraphBuilder.h"
+#include "../algebraic/SparseAccumulator.h"
 #include "../auxiliary/Timer.h"
 #include "../auxiliary/Log.h"
 
@@ -98,29 +100,45 @@ void ParallelPartitionCoarsening::run() {
 		timer2.stop();
 		INFO("combining coarse graphs took ", timer2.elapsedTag());
 	} else {
-		std::vector< std::vector<node> > nodesPerSuperNode(nextNodeId);
-		G.forNodes([&](node v) {
-			node sv = nodeToSuperNode[v];
-			nodesPerSuperNode[sv].push_back(v);
+		// bucket the nodes by supernode with a parallel counting sort
+		std::vector<std::atomic<index>> cursor(nextNodeId);
+		G.parallelForNodes([&](node v) {
+			cursor[nodeToSuperNode[v]].fetch_add(1, std::memory_order_relaxed);
+		});
+		std::vector<index> superNodeBegin(nextNodeId + 1, 0);
+		for (node su = 0; su < nextNodeId; su++) {
+			superNodeBegin[su + 1] = superNodeBegin[su] + cursor[su].load(std::memory_order_relaxed);
+			cursor[su].store(superNodeBegin[su], std::memory_order_relaxed);
+		}
+		std::vector<node> nodesBySuperNode(superNodeBegin[nextNodeId]);
+		G.parallelForNodes([&](node v) {
+			index pos = cursor[nodeToSuperNode[v]].fetch_add(1, std::memory_order_relaxed);
+			nodesBySuperNode[pos] = v;
 		});
 
 		// iterate over edges of G and create edges in coarse graph or update edge and node weights in Gcon
 		DEBUG("create edges in coarse graphs");
 		GraphBuilder b(nextNodeId, true, false);
+		std::vector<SparseAccumulator> outEdgesPerThread(omp_get_max_threads(), SparseAccumulator(nextNodeId));
 		#pragma omp parallel for schedule(guided)
 		for (node su = 0; su < nextNodeId; su++) {
-			std::map<index, edgeweight> outEdges;
-			for (node u : nodesPerSuperNode[su]) {
+			SparseAccumulator& outEdges = outEdgesPerThread[omp_get_thread_num()];
+			auto first = nodesBySuperNode.begin() + superNodeBegin[su];
+			auto last = nodesBySuperNode.begin() + superNodeBegin[su + 1];
+			std::sort(first, last); // fixed summation order regardless of the bucketing
+			for (auto it = first; it != last; ++it) {
+				node u = *it;
 				G.forNeighborsOf(u, [&](node v, edgeweight ew) {
 					node sv = nodeToSuperNode[v];
 					if (su != sv || u >= v) { // count edges inside uv only once (we iterate over them twice)
-						outEdges[sv] += ew;
+						outEdges.scatter(ew, sv);
 					}
 				});
 			}
-			for (auto it : outEdges) {
-				b.addHalfEdge(su, it.first, it.second);
-			}
+			outEdges.gather([&](index, index sv, double ew) {
+				b.addHalfEdge(su, sv, ew);
+			});
+			outEdges.increaseRow();
 		}
 
 		Gcombined = b.toGraph(false);
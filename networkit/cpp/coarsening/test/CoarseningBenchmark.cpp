@@ -10,6 +10,8 @@
 #include "CoarseningBenchmark.h"
 
 #include "../../generators/ErdosRenyiGenerator.h"
+#include "../../generators/LFRGenerator.h"
+#include "../../generators/RmatGenerator.h"
 #include "../../community/ClusteringGenerator.h"
 #include "../../coarsening/ParallelPartitionCoarsening.h"
 #include "../../coarsening/ClusteringProjector.h"
@@ -56,6 +58,46 @@ TEST_F(CoarseningBenchmark, benchmarkCoarsening) {
 }
 
 
+TEST_F(CoarseningBenchmark, benchmarkCoarseningOnLFRAndRmat) {
+	LFRGenerator lfr(100000);
+	lfr.generatePowerlawDegreeSequence(20, 500, -2);
+	lfr.generatePowerlawCommunitySizeSequence(20, 1000, -1);
+	lfr.setMu(0.3);
+	lfr.run();
+	Graph Glfr = lfr.getGraph();
+	Partition zetaLfr = lfr.getPartition();
+
+	RmatGenerator rmat(17, 16, 0.57, 0.19, 0.19, 0.05);
+	Graph Grmat = rmat.generate();
+	ClusteringGenerator clusteringGen;
+	Partition zetaRmat = clusteringGen.makeRandomClustering(Grmat, Grmat.numberOfNodes() / 100);
+
+	auto benchmark = [&](const std::string& name, const Graph& G, const Partition& zeta) {
+		Aux::Timer timer;
+		timer.start();
+		ParallelPartitionCoarsening localGraphs(G, zeta, false);
+		localGraphs.run();
+		timer.stop();
+		INFO(name, ", thread-local graphs: ", timer.elapsedTag());
+
+		timer.start();
+		ParallelPartitionCoarsening contraction(G, zeta, true);
+		contraction.run();
+		timer.stop();
+		INFO(name, ", bucketed contraction: ", timer.elapsedTag());
+
+		Graph Gc1 = localGraphs.getCoarseGraph();
+		Graph Gc2 = contraction.getCoarseGraph();
+		EXPECT_EQ(Gc1.numberOfNodes(), Gc2.numberOfNodes());
+		EXPECT_EQ(Gc1.numberOfEdges(), Gc2.numberOfEdges());
+		EXPECT_NEAR(Gc1.totalEdgeWeight(), Gc2.totalEdgeWeight(), 1e-6 * G.totalEdgeWeight());
+	};
+
+	benchmark("LFR", Glfr, zetaLfr);
+	benchmark("R-MAT", Grmat, zetaRmat);
+}
+
+
 
 } /* namespace NetworKit */
 
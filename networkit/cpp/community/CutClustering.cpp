@@ -3,7 +3,7 @@
  */
 
 #include "CutClustering.h"
-#include "../flow/EdmondsKarp.h"
+#include "../flow/PushRelabel.h"
 #include "../components/ConnectedComponents.h"
 #include "../auxiliary/Log.h"
 
@@ -30,7 +30,7 @@ void NetworKit::CutClustering::run() {
 		}
 	});
 
-	// Index edges (needed by Edmonds-Karp implementation)
+	// Index edges (needed by the push-relabel implementation)
 	graph.indexEdges();
 
 	// sort nodes by degree, this (heuristically) reduces the number of needed cut calculations
@@ -60,12 +60,15 @@ void NetworKit::CutClustering::run() {
 		});
 	}
 
+	// all cuts are computed in the same graph, so the flow algorithm reuses its residual network
+	PushRelabel flowAlgo(graph, none, t);
+
 	for (node u : sortedNodes) {
 		// the source sides have the property that they are nested, i.e. a node that
 		// is already in a cluster will always produce a source side that is completely
 		// contained in its cluster
 		if (!result.contains(u)) {
-			EdmondsKarp flowAlgo(graph, u, t);
+			flowAlgo.setTerminals(u, t);
 			flowAlgo.run();
 			std::vector<node> sourceSet(flowAlgo.getSourceSet());
 
@@ -26,7 +26,7 @@ public:
 	 * Apply algorithm to graph
 	 *
 	 * Warning: due to numerical errors the resulting clusters might not be correct.
-	 * This implementation uses the Edmonds-Karp algorithm for the cut calculation.
+	 * This implementation uses the push-relabel algorithm for the cut calculation.
 	 */
 	virtual void run() override;
 
@@ -12,12 +12,66 @@
 #include "../auxiliary/Log.h"
 #include "../auxiliary/Timer.h"
 #include "../auxiliary/SignalHandling.h"
+#include "../auxiliary/Random.h"
 
 
+#include <algorithm>
+#include <atomic>
 #include <sstream>
 
 namespace NetworKit {
 
+namespace {
+
+/**
+ * Dense accumulator for the edge weight from one node to each neighboring community,
+ * in the style of SparseAccumulator. Entries are invalidated by increasing a stamp
+ * instead of clearing the values, so a node visit costs time linear in its degree.
+ */
+class AffinityAccumulator {
+public:
+	/**
+	 * Invalidates all entries and makes room for community ids below @a upperBound.
+	 */
+	void reset(index upperBound) {
+		if (values.size() < upperBound) {
+			values.resize(upperBound);
+			stamps.resize(upperBound, 0);
+		}
+		stamp++;
+		communities.clear();
+	}
+
+	void add(index C, edgeweight w) {
+		if (stamps[C] != stamp) {
+			stamps[C] = stamp;
+			values[C] = w;
+			communities.push_back(C);
+		} else {
+			values[C] += w;
+		}
+	}
+
+	edgeweight get(index C) const {
+		return stamps[C] == stamp ? values[C] : 0.0;
+	}
+
+	/**
+	 * Communities with a valid entry, in insertion order.
+	 */
+	const std::vector<index>& keys() const {
+		return communities;
+	}
+
+private:
+	count stamp = 0;
+	std::vector<edgeweight> values;
+	std::vector<count> stamps;
+	std::vector<index> communities;
+};
+
+} /* anonymous namespace */
+
 PLM::PLM(const Graph& G, bool refine, double gamma, std::string par, count maxIter, bool turbo, bool recurse) : CommunityDetectionAlgorithm(G), parallelism(par), refine(refine), gamma(gamma), maxIter(maxIter), turbo(turbo), recurse(recurse) {
 
 }
@@ -62,25 +116,13 @@ void PLM::run() {
 	bool moved = false; // indicates whether any node has been moved in the last pass
 	bool change = false; // indicates whether the communities have changed at all
 
-	// stores the affinity for each neighboring community (index), one vector per thread
-	std::vector<std::vector<edgeweight> > turboAffinity;
-	// stores the list of neighboring communities, one vector per thread
-	std::vector<std::vector<index> > neigh_comm;
-
+	// dense per-thread accumulators for the affinity to neighboring communities
+	std::vector<AffinityAccumulator> affinities(omp_get_max_threads());
 
-	if (turbo) {
-		if (this->parallelism != "none" && this->parallelism != "none randomized") { // initialize arrays for all threads only when actually needed
-			turboAffinity.resize(omp_get_max_threads());
-			neigh_comm.resize(omp_get_max_threads());
-			for (auto &it : turboAffinity) {
-				// resize to maximum community id
-				it.resize(zeta.upperBound());
-			}
-		} else { // initialize array only for first thread
-			turboAffinity.emplace_back(zeta.upperBound());
-			neigh_comm.emplace_back();
-		}
-	}
+	// worklist of the nodes whose neighborhood changed in the last pass, the first pass visits all nodes
+	std::vector<node> activeNodes;
+	std::vector<std::atomic<bool>> queued(z); // record if node is already in the next worklist
+	std::vector<std::vector<node>> nextActive(omp_get_max_threads());
 
 	// try to improve modularity by moving a node to neighboring clusters
 	auto tryMove = [&](node u) {
@@ -88,33 +130,14 @@ void PLM::run() {
 		index tid = omp_get_thread_num();
 
 		// collect edge weight to neighbor clusters
-		std::map<index, edgeweight> affinity;
-
-		if (turbo) {
-			neigh_comm[tid].clear();
-			G.forNeighborsOf(u, [&](node v) {
-				turboAffinity[tid][zeta[v]] = -1; // set all to -1 so we can see when we get to it the first time
-			});
-			turboAffinity[tid][zeta[u]] = 0;
-			G.forNeighborsOf(u, [&](node v, edgeweight weight) {
-				if (u != v) {
-					index C = zeta[v];
-					if (turboAffinity[tid][C] == -1) {
-						// found the neighbor for the first time, initialize to 0 and add to list of neighboring communities
-						turboAffinity[tid][C] = 0;
-						neigh_comm[tid].push_back(C);
-					}
-					turboAffinity[tid][C] += weight;
-				}
-			});
-		} else {
-			G.forNeighborsOf(u, [&](node v, edgeweight weight) {
-				if (u != v) {
-					index C = zeta[v];
-					affinity[C] += weight;
-				}
-			});
-		}
+		AffinityAccumulator& affinity = affinities[tid];
+		affinity.reset(o);
+		affinity.add(zeta[u], 0);
+		G.forNeighborsOf(u, [&](node v, edgeweight weight) {
+			if (u != v) {
+				affinity.add(zeta[v], weight);
+			}
+		});
 
 
 		// sub-functions
@@ -151,33 +174,16 @@ void PLM::run() {
 
 		C = zeta[u];
 
-		if (turbo) {
-			edgeweight affinityC = turboAffinity[tid][C];
+		edgeweight affinityC = affinity.get(C);
 
-			for (index D : neigh_comm[tid]) {
-				if (D != C) { // consider only nodes in other clusters (and implicitly only nodes other than u)
-					double delta = modGain(u, C, D, affinityC, turboAffinity[tid][D]);
-
-					// TRACE("mod gain: " , delta);
-					if (delta > deltaBest) {
-						deltaBest = delta;
-						best = D;
-					}
-				}
-			}
-		} else {
-			edgeweight affinityC = affinity[C];
-
-//			TRACE("Processing neighborhood of node " , u , ", which is in cluster " , C);
-			for (auto it : affinity) {
-				index D = it.first;
-				if (D != C) { // consider only nodes in other clusters (and implicitly only nodes other than u)
-					double delta = modGain(u, C, D, affinityC, it.second);
-					// TRACE("mod gain: " , delta);
-					if (delta > deltaBest) {
-						deltaBest = delta;
-						best = D;
-					}
+//		TRACE("Processing neighborhood of node " , u , ", which is in cluster " , C);
+		for (index D : affinity.keys()) {
+			if (D != C) { // consider only nodes in other clusters (and implicitly only nodes other than u)
+				double delta = modGain(u, C, D, affinityC, affinity.get(D));
+				// TRACE("mod gain: " , delta);
+				if (delta > deltaBest) {
+					deltaBest = delta;
+					best = D;
 				}
 			}
 		}
@@ -198,6 +204,13 @@ void PLM::run() {
 			#pragma omp atomic update
 			volCommunity[best] += volN;
 
+			// the neighbors see a changed neighborhood, so they need to be visited again
+			G.forNeighborsOf(u, [&](node v) {
+				if (!queued[v].exchange(true, std::memory_order_relaxed)) {
+					nextActive[tid].push_back(v);
+				}
+			});
+
 			moved = true; // change to clustering has been made
 
 		} else {
@@ -211,7 +224,28 @@ void PLM::run() {
 		do {
 			moved = false;
 			// apply node movement according to parallelization strategy
-			if (this->parallelism == "none") {
+			if (iter > 0) {
+				// later passes only visit the worklist, in node order unless randomized
+				std::sort(activeNodes.begin(), activeNodes.end());
+				if (this->parallelism == "simple") {
+					#pragma omp parallel for
+					for (index i = 0; i < activeNodes.size(); ++i) {
+						tryMove(activeNodes[i]);
+					}
+				} else if (this->parallelism == "balanced") {
+					#pragma omp parallel for schedule(guided)
+					for (index i = 0; i < activeNodes.size(); ++i) {
+						tryMove(activeNodes[i]);
+					}
+				} else {
+					if (this->parallelism == "none randomized") {
+						std::shuffle(activeNodes.begin(), activeNodes.end(), Aux::Random::getURNG());
+					}
+					for (node u : activeNodes) {
+						tryMove(u);
+					}
+				}
+			} else if (this->parallelism == "none") {
 				G.forNodes(tryMove);
 			} else if (this->parallelism == "simple") {
 				G.parallelForNodes(tryMove);
@@ -225,6 +259,16 @@ void PLM::run() {
 			}
 			if (moved) change = true;
 
+			// collect the next worklist
+			activeNodes.clear();
+			for (auto& local : nextActive) {
+				for (node u : local) {
+					queued[u].store(false, std::memory_order_relaxed);
+				}
+				activeNodes.insert(activeNodes.end(), local.begin(), local.end());
+				local.clear();
+			}
+
 			if (iter == maxIter) {
 				WARN("move phase aborted after ", maxIter, " iterations");
 			}
@@ -15,6 +15,7 @@ namespace NetworKit {
 /**
  * @ingroup community
  * Parallel Louvain Method - a multi-level modularity maximizer.
+ * After the first pass, a move phase only revisits nodes with a neighbor that changed its community.
  */
 class PLM: public NetworKit::CommunityDetectionAlgorithm {
 
@@ -29,7 +30,7 @@ public:
 	 * 							2m 	-> singleton communities
 	 * @param[in]	maxIter		maximum number of iterations for move phase
 	 * @param[in]	parallelCoarsening	use parallel graph coarsening
-	 * @param[in]	turbo	faster but uses O(n) additional memory per thread
+	 * @param[in]	turbo	ignored, kept for compatibility. The affinities are always accumulated densely, which uses O(n) additional memory per thread
 	 * @param[in]	recurse	use recursive coarsening, see http://journals.aps.org/pre/abstract/10.1103/PhysRevE.89.049902 for some explanations (default: true)
 	 *
 	 */
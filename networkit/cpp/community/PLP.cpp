@@ -8,6 +8,7 @@
 #include "PLP.h"
 
 #include <omp.h>
+#include <atomic>
 #include "../Globals.h"
 #include "../auxiliary/Log.h"
 #include "../auxiliary/Timer.h"
@@ -19,7 +20,7 @@ PLP::PLP(const Graph& G, count theta, count maxIterations) : CommunityDetectionA
 }
 
 
-PLP::PLP(const Graph& G, const Partition baseClustering, count theta) : CommunityDetectionAlgorithm(G, baseClustering), updateThreshold(theta) {
+PLP::PLP(const Graph& G, const Partition baseClustering, count theta) : CommunityDetectionAlgorithm(G, baseClustering), updateThreshold(theta), maxIterations(none) {
 }
 
 void PLP::run() {
@@ -27,6 +28,10 @@ void PLP::run() {
 		throw std::runtime_error("The algorithm has already run on the graph.");
 	}
 
+	// the statistics describe this run only
+	timing.clear();
+	activeSetSizes.clear();
+
 	// set unique label for each node if no baseClustering was given
 	index z = G.upperNodeIdBound();
 	if (result.numberOfElements() != z) {
@@ -60,51 +65,90 @@ void PLP::run() {
 	 * In general this does not work. It was changed to: No label was changed in last iteration.
 	 */
 
-	std::vector<bool> activeNodes(z); // record if node must be processed
-	activeNodes.assign(z, true);
+	// worklist of the nodes whose neighborhood changed, isolated nodes are never processed
+	std::vector<node> activeNodes;
+	activeNodes.reserve(n);
+	G.forNodes([&](node v) {
+		if (G.degree(v) > 0) {
+			activeNodes.push_back(v);
+		}
+	});
+	std::vector<std::atomic<bool>> queued(z); // record if node is already in the next worklist
+
+	// per-thread label weights, only the entries touched by the current node are reset
+	count maxThreads = omp_get_max_threads();
+	std::vector<std::vector<double>> labelWeights(maxThreads);
+	std::vector<std::vector<char>> labelSeen(maxThreads);
+	std::vector<std::vector<label>> touchedLabels(maxThreads);
+	std::vector<std::vector<node>> nextActive(maxThreads);
 
 	Aux::Timer runtime;
 
 	// propagate labels
-	while ((nUpdated > this->updateThreshold)  && (nIterations < maxIterations)) { // as long as a label has changed... or maximum iterations reached
+	while ((nUpdated > this->updateThreshold)  && (nIterations < maxIterations) && !activeNodes.empty()) { // as long as a label has changed... or maximum iterations reached
 		runtime.start();
 		nIterations += 1;
 		INFO("[BEGIN] LabelPropagation: iteration #" , nIterations);
+		activeSetSizes.push_back(activeNodes.size());
 
 		// reset updated
 		nUpdated = 0;
 
-		G.balancedParallelForNodes([&](node v){
-			if ((activeNodes[v]) && (G.degree(v) > 0)) {
-
-				std::map<label, double> labelWeights; // neighborLabelCounts maps label -> frequency in the neighbors
-
-				// weigh the labels in the neighborhood of v
-				G.forNeighborsOf(v, [&](node w, edgeweight weight) {
-					label lw = result.subsetOf(w);
-					labelWeights[lw] += weight; // add weight of edge {v, w}
-				});
+		#pragma omp parallel for schedule(guided) reduction(+:nUpdated)
+		for (index i = 0; i < activeNodes.size(); ++i) {
+			node v = activeNodes[i];
+			index tid = omp_get_thread_num();
+			std::vector<double>& weights = labelWeights[tid];
+			std::vector<char>& seen = labelSeen[tid];
+			std::vector<label>& touched = touchedLabels[tid];
+			if (weights.size() < result.upperBound()) {
+				weights.resize(result.upperBound(), 0.0);
+				seen.resize(result.upperBound(), 0);
+			}
 
-				// get heaviest label
-				label heaviest = std::max_element(labelWeights.begin(),
-								labelWeights.end(),
-								[](const std::pair<label, edgeweight>& p1, const std::pair<label, edgeweight>& p2) {
-									return p1.second < p2.second;})->first;
-
-				if (result.subsetOf(v) != heaviest) { // UPDATE
-					result.moveToSubset(heaviest,v); //result[v] = heaviest;
-					nUpdated += 1; // TODO: atomic update?
-					G.forNeighborsOf(v, [&](node u) {
-						activeNodes[u] = true;
-					});
-				} else {
-					activeNodes[v] = false;
+			// weigh the labels in the neighborhood of v
+			G.forNeighborsOf(v, [&](node w, edgeweight weight) {
+				label lw = result.subsetOf(w);
+				if (!seen[lw]) {
+					seen[lw] = 1;
+					touched.push_back(lw);
+				}
+				weights[lw] += weight; // add weight of edge {v, w}
+			});
+
+			// get heaviest label, ties are broken by the smallest label
+			label heaviest = none;
+			for (label l : touched) {
+				if (heaviest == none || weights[l] > weights[heaviest] || (weights[l] == weights[heaviest] && l < heaviest)) {
+					heaviest = l;
 				}
+			}
+			for (label l : touched) {
+				weights[l] = 0.0;
+				seen[l] = 0;
+			}
+			touched.clear();
+
+			if (heaviest != none && result.subsetOf(v) != heaviest) { // UPDATE
+				result.moveToSubset(heaviest,v); //result[v] = heaviest;
+				nUpdated += 1;
+				G.forNeighborsOf(v, [&](node u) {
+					if (!queued[u].exchange(true, std::memory_order_relaxed)) {
+						nextActive[tid].push_back(u);
+					}
+				});
+			}
+		}
 
-			} else {
-				// node is isolated
+		// collect the next worklist
+		activeNodes.clear();
+		for (auto& local : nextActive) {
+			for (node u : local) {
+				queued[u].store(false, std::memory_order_relaxed);
 			}
-		});
+			activeNodes.insert(activeNodes.end(), local.begin(), local.end());
+			local.clear();
+		}
 
 		// for each while loop iteration...
 
@@ -138,4 +182,9 @@ std::vector<count> PLP::getTiming() {
 	return this->timing;
 }
 
+
+std::vector<count> PLP::getActiveSetSizes() {
+	return this->activeSetSizes;
+}
+
 } /* namespace NetworKit */
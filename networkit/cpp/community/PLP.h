@@ -31,6 +31,7 @@ protected:
 	count maxIterations;
 	count nIterations = 0; //!< number of iterations in last run
 	std::vector<count> timing;	//!< running times for each iteration
+	std::vector<count> activeSetSizes;	//!< number of nodes processed in each iteration
 
 
 public:
@@ -86,6 +87,14 @@ public:
 	*/
 	virtual std::vector<count> getTiming();
 
+	/**
+	* Get the number of active nodes for each iteration. After the first iteration, only nodes
+	* with a neighbor that changed its label in the previous iteration are active.
+	*
+	* @return The list of active set sizes
+	*/
+	virtual std::vector<count> getActiveSetSizes();
+
 
 };
 
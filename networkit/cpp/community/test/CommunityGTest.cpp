@@ -105,6 +105,29 @@ TEST_F(CommunityGTest, testLabelPropagationOnDisconnectedGraph) {
 }
 
 
+TEST_F(CommunityGTest, testLabelPropagationActiveSets) {
+	count n = 1000;
+	count k = 10; // number of clusters
+	ClusteredRandomGraphGenerator graphGen(n, k, 0.5, 0.002);
+	Graph G = graphGen.generate();
+	node isolated = G.addNode();
+
+	PLP lp(G, 0);
+	lp.run();
+	Partition zeta = lp.getPartition();
+	EXPECT_TRUE(GraphClusteringTools::isProperClustering(G, zeta));
+	EXPECT_EQ(zeta.subsetSizeMap()[zeta[isolated]], 1u);
+
+	std::vector<count> activeSetSizes = lp.getActiveSetSizes();
+	ASSERT_EQ(lp.numberOfIterations(), activeSetSizes.size());
+	EXPECT_EQ(lp.numberOfIterations(), lp.getTiming().size());
+	EXPECT_EQ(n, activeSetSizes[0]) << "all non-isolated nodes are active in the first iteration";
+	for (count size : activeSetSizes) {
+		EXPECT_LE(size, n);
+	}
+}
+
+
 TEST_F(CommunityGTest, testLabelPropagationOnSingleNodeWithSelfLoop) {
 	Graph G(1, true);
 	node v = 0;
@@ -196,6 +219,30 @@ TEST_F(CommunityGTest, testPLM) {
 
 }
 
+TEST_F(CommunityGTest, testPLMModularityAgainstBaseline) {
+	// modularity of PLM with refinement and without turbo before it used worklists, with the sequential strategy
+	std::vector<std::pair<std::string, double>> baseline = {{"input/PGPgiantcompo.graph", 0.883388},
+		{"input/jazz.graph", 0.445144}, {"input/celegans_metabolic.graph", 0.443632}};
+	METISGraphReader reader;
+	Modularity modularity;
+
+	for (auto& entry : baseline) {
+		Graph G = reader.read(entry.first);
+		for (std::string par : {"none", "balanced"}) {
+			for (bool turbo : {false, true}) {
+				PLM plm(G, true, 1.0, par, 32, turbo);
+				plm.run();
+				Partition zeta = plm.getPartition();
+				EXPECT_TRUE(GraphClusteringTools::isProperClustering(G, zeta));
+
+				double mod = modularity.getQuality(zeta, G);
+				INFO(entry.first, ", ", par, ", turbo ", turbo, ": modularity ", mod, ", baseline ", entry.second);
+				EXPECT_GE(mod, entry.second - 0.01) << entry.first << ", " << par << ", turbo " << turbo;
+			}
+		}
+	}
+}
+
 TEST_F(CommunityGTest, testDeletedNodesPLM) {
 	METISGraphReader reader;
 	Modularity modularity;
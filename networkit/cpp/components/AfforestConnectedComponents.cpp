@@ -0,0 +1,122 @@
+/*
+ * AfforestConnectedComponents.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: NetworKit contributors
+ */
+
+#include "AfforestConnectedComponents.h"
+#include "../structures/ConcurrentUnionFind.h"
+
+#include <unordered_map>
+
+namespace NetworKit {
+
+constexpr count AfforestConnectedComponents::neighborRounds;
+constexpr count AfforestConnectedComponents::numSamples;
+
+AfforestConnectedComponents::AfforestConnectedComponents(const Graph& G) : G(G), numComponents(0) {
+	if (G.isDirected()) {
+		throw std::runtime_error("Error, connected components of directed graphs cannot be computed, use StronglyConnectedComponents for them.");
+	}
+}
+
+void AfforestConnectedComponents::run() {
+	const count z = G.upperNodeIdBound();
+	ConcurrentUnionFind unionFind(z);
+
+	// merge the first edges of every node
+	for (index r = 0; r < neighborRounds; ++r) {
+		G.parallelForNodes([&](node u) {
+			if (r < G.degree(u)) {
+				node v = G.getIthNeighbor<true>(u, r);
+				if (v != none) {
+					unionFind.merge(u, v);
+				}
+			}
+		});
+		unionFind.compress();
+	}
+
+	// the most frequent representative in a sample is most likely the one of the largest component
+	index largest = none;
+	if (G.numberOfNodes() > 0) {
+		std::unordered_map<index, count> frequency;
+		count maxFrequency = 0;
+		for (index i = 0; i < numSamples; ++i) {
+			index c = unionFind.find(G.randomNode());
+			if (++frequency[c] > maxFrequency) {
+				maxFrequency = frequency[c];
+				largest = c;
+			}
+		}
+	}
+
+	// nodes of the largest component can skip their edges, the other endpoint merges them if necessary
+	G.balancedParallelForNodes([&](node u) {
+		if (unionFind.find(u) != largest) {
+			G.forNeighborsOf(u, [&](node v) {
+				unionFind.merge(u, v);
+			});
+		}
+	});
+
+	// number the components in the order of their representative, which is their smallest node
+	std::vector<index> componentOfRoot(z, none);
+	G.parallelForNodes([&](node u) {
+		if (unionFind.find(u) == u) {
+			componentOfRoot[u] = 0;
+		}
+	});
+	numComponents = 0;
+	for (index u = 0; u < z; ++u) {
+		if (componentOfRoot[u] != none) {
+			componentOfRoot[u] = numComponents++;
+		}
+	}
+
+	component = Partition(z, none);
+	component.setUpperBound(numComponents);
+	G.parallelForNodes([&](node u) {
+		component[u] = componentOfRoot[unionFind.find(u)];
+	});
+
+	hasRun = true;
+}
+
+count AfforestConnectedComponents::numberOfComponents() const {
+	if (!hasRun) throw std::runtime_error("run method has not been called");
+	return numComponents;
+}
+
+count AfforestConnectedComponents::componentOfNode(node u) const {
+	if (!hasRun) throw std::runtime_error("run method has not been called");
+	assert (component[u] != none);
+	return component[u];
+}
+
+Partition AfforestConnectedComponents::getPartition() const {
+	if (!hasRun) throw std::runtime_error("run method has not been called");
+	return component;
+}
+
+std::vector<std::vector<node> > AfforestConnectedComponents::getComponents() const {
+	if (!hasRun) throw std::runtime_error("run method has not been called");
+
+	std::vector<std::vector<node> > result(numComponents);
+	G.forNodes([&](node u) {
+		result[component[u]].push_back(u);
+	});
+
+	return result;
+}
+
+std::string AfforestConnectedComponents::toString() const {
+	return "AfforestConnectedComponents";
+}
+
+bool AfforestConnectedComponents::isParallel() const {
+	return true;
+}
+
+}
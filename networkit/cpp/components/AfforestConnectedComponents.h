@@ -0,0 +1,90 @@
+/*
+ * AfforestConnectedComponents.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef AFFORESTCONNECTEDCOMPONENTS_H_
+#define AFFORESTCONNECTEDCOMPONENTS_H_
+
+#include "../graph/Graph.h"
+#include "../structures/Partition.h"
+#include "../base/Algorithm.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup components
+ * Determines the connected components of an undirected graph in parallel with a concurrent union-find, following
+ * the Afforest algorithm [0]. First, the first few edges of every node are merged, which usually already forms the
+ * largest component. Its representative is then estimated by sampling, and only the nodes outside of it merge
+ * along all their edges. The running time does not depend on the diameter of the graph.
+ *
+ * The components are numbered in the order of their smallest node, so the result is the same as the one of
+ * ConnectedComponents.
+ *
+ * [0] Afforest: A Fast Concurrent Connected Components Algorithm
+ * Michael Sutton, Tal Ben-Nun and Amnon Barak
+ * 2018 IEEE International Parallel and Distributed Processing Symposium (IPDPS). 2018, 25-34
+ */
+class AfforestConnectedComponents : public Algorithm {
+public:
+	/** number of edges of each node merged before the largest component is sampled */
+	static constexpr count neighborRounds = 2;
+
+	/** number of nodes sampled to find the largest component */
+	static constexpr count numSamples = 1024;
+
+	/**
+	 * Create AfforestConnectedComponents class for the undirected Graph @a G.
+	 *
+	 * @param G The graph.
+	 */
+	AfforestConnectedComponents(const Graph& G);
+
+	/**
+	 * This method determines the connected components for the graph given in the constructor.
+	 */
+	void run() override;
+
+	/**
+	 * Get the number of connected components.
+	 *
+	 * @return The number of connected components.
+	 */
+	count numberOfComponents() const;
+
+	/**
+	 * Get the the component in which node @a u is situated.
+	 *
+	 * @param[in]	u	The node whose component is asked for.
+	 */
+	count componentOfNode(node u) const;
+
+	/**
+	 * Get a Partition that represents the components.
+	 *
+	 * @return A partition representing the found components.
+	 */
+	Partition getPartition() const;
+
+	/**
+	 * @return Vector of components, each stored as vector of nodes.
+	 */
+	std::vector<std::vector<node> > getComponents() const;
+
+	std::string toString() const override;
+
+	bool isParallel() const override;
+
+private:
+	const Graph& G;
+	Partition component;
+	count numComponents;
+};
+
+}
+
+
+#endif /* AFFORESTCONNECTEDCOMPONENTS_H_ */
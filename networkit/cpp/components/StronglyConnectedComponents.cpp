@@ -8,9 +8,11 @@
  *  -- Obada Mahdi <omahdi@gmail.com>
  */
 
+#include <algorithm>
 #include <stack>
 #include <functional>
 #include <tuple>
+#include <atomic>
 
 #include "StronglyConnectedComponents.h"
 #include "../structures/Partition.h"
@@ -164,6 +166,224 @@ void StronglyConnectedComponents::runIteratively() {
 	//DEBUG("max_stack_size = ", max_stack_size, ", node count = ", z);
 }
 
+void StronglyConnectedComponents::runParallel() {
+	const count z = G.upperNodeIdBound();
+
+	// representative of the component of each node, none while the node is unassigned
+	std::vector<std::atomic<index>> rep(z);
+	std::vector<std::atomic<count>> inDeg(z), outDeg(z);
+	std::vector<node> remaining;
+	G.parallelForNodes([&](node u) {
+		rep[u] = none;
+		inDeg[u] = G.degreeIn(u);
+		outDeg[u] = G.degreeOut(u);
+	});
+	G.forNodes([&](node u) {
+		remaining.push_back(u);
+	});
+
+	auto claim = [&](node u, index r) {
+		index expected = none;
+		return rep[u].compare_exchange_strong(expected, r);
+	};
+
+	// one step of a parallel breadth-first search: expand(u, next) appends the newly visited neighbors of u to next
+	auto parallelStep = [&](const std::vector<node>& frontier, std::function<void(node, std::vector<node>&)> expand) {
+		std::vector<node> next;
+#pragma omp parallel
+		{
+			std::vector<node> local;
+#pragma omp for schedule(dynamic, 64) nowait
+			for (index i = 0; i < frontier.size(); ++i) {
+				expand(frontier[i], local);
+			}
+#pragma omp critical
+			next.insert(next.end(), local.begin(), local.end());
+		}
+		return next;
+	};
+
+	// trim nodes without in- or out-edges to unassigned nodes, they form trivial components
+	std::vector<node> frontier;
+	for (node u : remaining) {
+		if (inDeg[u] == 0 || outDeg[u] == 0) {
+			frontier.push_back(u);
+			rep[u] = u;
+		}
+	}
+	while (!frontier.empty()) {
+		frontier = parallelStep(frontier, [&](node u, std::vector<node>& next) {
+			G.forNeighborsOf(u, [&](node v) {
+				if (--inDeg[v] == 0 && claim(v, v)) {
+					next.push_back(v);
+				}
+			});
+			G.forInEdgesOf(u, [&](node, node v) {
+				if (--outDeg[v] == 0 && claim(v, v)) {
+					next.push_back(v);
+				}
+			});
+		});
+	}
+
+	auto removeAssigned = [&]() {
+		remaining.erase(std::remove_if(remaining.begin(), remaining.end(), [&](node u) {
+			return rep[u] != none;
+		}), remaining.end());
+	};
+	removeAssigned();
+
+	// forward-backward search from the node most likely to be in the giant component
+	if (!remaining.empty()) {
+		node pivot = *std::max_element(remaining.begin(), remaining.end(), [&](node u, node v) {
+			return inDeg[u] * outDeg[u] < inDeg[v] * outDeg[v];
+		});
+
+		std::vector<std::atomic<bool>> reached(z);
+		G.parallelForNodes([&](node u) {
+			reached[u] = false;
+		});
+
+		reached[pivot] = true;
+		frontier = {pivot};
+		while (!frontier.empty()) {
+			frontier = parallelStep(frontier, [&](node u, std::vector<node>& next) {
+				G.forNeighborsOf(u, [&](node v) {
+					if (rep[v] == none && !reached[v] && !reached[v].exchange(true)) {
+						next.push_back(v);
+					}
+				});
+			});
+		}
+
+		claim(pivot, pivot);
+		frontier = {pivot};
+		while (!frontier.empty()) {
+			frontier = parallelStep(frontier, [&](node u, std::vector<node>& next) {
+				G.forInEdgesOf(u, [&](node, node v) {
+					if (reached[v] && claim(v, pivot)) {
+						next.push_back(v);
+					}
+				});
+			});
+		}
+		removeAssigned();
+	}
+
+	// coloring: the color of a node is the largest id of a remaining node that reaches it
+	std::vector<std::atomic<index>> color(z);
+	std::vector<std::atomic<bool>> active(z);
+	G.parallelForNodes([&](node u) {
+		color[u] = none;
+		active[u] = false;
+	});
+	while (!remaining.empty()) {
+#pragma omp parallel for
+		for (index i = 0; i < remaining.size(); ++i) {
+			color[remaining[i]] = remaining[i];
+		}
+
+		frontier = remaining;
+		while (!frontier.empty()) {
+			frontier = parallelStep(frontier, [&](node u, std::vector<node>& next) {
+				active[u] = false;
+				const index c = color[u];
+				G.forNeighborsOf(u, [&](node v) {
+					if (rep[v] != none) {
+						return;
+					}
+					index old = color[v];
+					while (old < c && !color[v].compare_exchange_weak(old, c)) {}
+					if (old < c && !active[v].exchange(true)) {
+						next.push_back(v);
+					}
+				});
+			});
+		}
+
+		// the component of a root consists of the nodes of its color that reach it
+		frontier.clear();
+		for (node u : remaining) {
+			if (color[u] == u) {
+				rep[u] = u;
+				frontier.push_back(u);
+			}
+		}
+		while (!frontier.empty()) {
+			frontier = parallelStep(frontier, [&](node u, std::vector<node>& next) {
+				const index c = color[u];
+				G.forInEdgesOf(u, [&](node, node v) {
+					if (color[v] == c && claim(v, c)) {
+						next.push_back(v);
+					}
+				});
+			});
+		}
+		removeAssigned();
+	}
+
+	// number the components like Tarjan's algorithm, from 1 in reverse topological order of the condensation:
+	// a component gets its id once all components it has edges to are numbered
+	std::vector<index> memberBegin(z + 1, 0);
+	G.forNodes([&](node u) {
+		++memberBegin[rep[u] + 1];
+	});
+	for (index i = 0; i < z; ++i) {
+		memberBegin[i + 1] += memberBegin[i];
+	}
+	std::vector<node> members(memberBegin[z]);
+	{
+		std::vector<index> pos(memberBegin.begin(), memberBegin.end() - 1);
+		G.forNodes([&](node u) {
+			members[pos[rep[u]]++] = u;
+		});
+	}
+
+	std::vector<std::atomic<count>> pending(z);
+	G.parallelForNodes([&](node u) {
+		pending[u] = 0;
+	});
+	G.balancedParallelForNodes([&](node u) {
+		const index r = rep[u];
+		G.forNeighborsOf(u, [&](node v) {
+			if (rep[v] != r) {
+				++pending[r];
+			}
+		});
+	});
+
+	frontier.clear();
+	G.forNodes([&](node u) {
+		if (rep[u] == u && pending[u] == 0) {
+			frontier.push_back(u);
+		}
+	});
+	std::vector<index> id(z, none);
+	count k = 0;
+	while (!frontier.empty()) {
+		std::sort(frontier.begin(), frontier.end());
+		for (node r : frontier) {
+			id[r] = ++k;
+		}
+		frontier = parallelStep(frontier, [&](node r, std::vector<node>& next) {
+			for (index i = memberBegin[r]; i < memberBegin[r + 1]; ++i) {
+				G.forInEdgesOf(members[i], [&](node, node v) {
+					const index s = rep[v];
+					if (s != r && --pending[s] == 0) {
+						next.push_back(s);
+					}
+				});
+			}
+		});
+	}
+
+	component = Partition(z);
+	component.setUpperBound(k + 1);
+	G.parallelForNodes([&](node u) {
+		component[u] = id[rep[u]];
+	});
+}
+
 Partition StronglyConnectedComponents::getPartition() {
 	return this->component;
 }
@@ -16,6 +16,9 @@ namespace NetworKit {
 /**
  * @ingroup components
  * Determines the strongly connected components of an directed graph.
+ * The component ids start at 1 and follow the reverse topological order of the components: an edge between two
+ * different components always leads to the smaller id (Tarjan's algorithm finishes the components in this order).
+ * The ids may differ between the implementations, but the components are the same.
  */
 class StronglyConnectedComponents {
 public:
@@ -39,6 +42,27 @@ public:
 	 */
 	void runRecursively();
 
+	/**
+	 * This method determines the connected components for the graph g
+	 * (parallel implementation).
+	 *
+	 * Nodes without remaining in- or out-edges are trimmed first as trivial components. Then the component of the
+	 * node with the largest product of in- and out-degree, usually the giant component, is found by a forward and a
+	 * backward breadth-first search [0]. The remaining nodes are colored with the largest node id that reaches them;
+	 * each node whose color is its own id is the root of a component, which consists of the nodes of its color that
+	 * reach it [1]. Coloring is repeated until all nodes are assigned. Finally, the components are numbered in reverse
+	 * topological order by a level-synchronous topological sort of the component graph.
+	 *
+	 * [0] On Fast Parallel Detection of Strongly Connected Components (SCC) in Small-World Graphs
+	 * Sungpack Hong, Nicole C. Rodia and Kunle Olukotun
+	 * 2013 International Conference for High Performance Computing, Networking, Storage and Analysis (SC). 2013
+	 *
+	 * [1] BFS and Coloring-Based Parallel Algorithms for Strongly Connected Components and Related Problems
+	 * George M. Slota, Sivasankaran Rajamanickam and Kamesh Madduri
+	 * 2014 IEEE 28th International Parallel and Distributed Processing Symposium (IPDPS). 2014, 550-559
+	 */
+	void runParallel();
+
 	/**
 	 * This method returns the number of connected components.
 	 */
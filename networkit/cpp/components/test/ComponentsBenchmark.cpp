@@ -0,0 +1,72 @@
+/*
+ * ComponentsBenchmark.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef NOGTEST
+
+#include "ComponentsBenchmark.h"
+
+#include "../StronglyConnectedComponents.h"
+#include "../../io/EdgeListReader.h"
+#include "../../io/KONECTGraphReader.h"
+#include "../../auxiliary/Random.h"
+#include "../../auxiliary/Timer.h"
+#include "../../auxiliary/Log.h"
+
+namespace NetworKit {
+
+namespace {
+
+void compareSCC(const Graph& G, const std::string& graphName) {
+	StronglyConnectedComponents scc(G);
+	Aux::Timer timer;
+
+	timer.start();
+	scc.runIteratively();
+	timer.stop();
+	Partition expected = scc.getPartition();
+	INFO(graphName, ": n = ", G.numberOfNodes(), ", m = ", G.numberOfEdges(), ", ", scc.numberOfComponents(), " components");
+	INFO("Tarjan: ", timer.elapsedMilliseconds(), " ms");
+
+	timer.start();
+	scc.runParallel();
+	timer.stop();
+	INFO("parallel: ", timer.elapsedMilliseconds(), " ms");
+
+	// compare the components, the ids may differ
+	Partition actual = scc.getPartition();
+	expected.compact(true);
+	actual.compact(true);
+	G.forNodes([&](node u) {
+		ASSERT_EQ(expected[u], actual[u]);
+	});
+}
+
+} // namespace
+
+TEST_F(ComponentsBenchmark, benchStronglyConnectedComponentsOnSNAPGraph) {
+	EdgeListReader reader('\t', 0, "#", false, true);
+	compareSCC(reader.read("input/wiki-Vote.txt"), "wiki-Vote");
+}
+
+TEST_F(ComponentsBenchmark, benchStronglyConnectedComponentsOnKONECTGraph) {
+	KONECTGraphReader reader(' ');
+	compareSCC(reader.read("input/foodweb-baydry.konect"), "foodweb-baydry");
+}
+
+TEST_F(ComponentsBenchmark, benchStronglyConnectedComponentsOnRandomGraph) {
+	// every node has two random out-neighbors, which forms a giant component and many small ones
+	Graph G(1000000, false, true);
+	G.forNodes([&](node u) {
+		G.addEdge(u, Aux::Random::integer(G.upperNodeIdBound() - 1));
+		G.addEdge(u, Aux::Random::integer(G.upperNodeIdBound() - 1));
+	});
+	compareSCC(G, "random digraph");
+}
+
+} /* namespace NetworKit */
+
+#endif /* NOGTEST */
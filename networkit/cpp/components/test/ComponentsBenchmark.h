@@ -0,0 +1,27 @@
+/*
+ * ComponentsBenchmark.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef NOGTEST
+
+#ifndef COMPONENTSBENCHMARK_H_
+#define COMPONENTSBENCHMARK_H_
+
+#include <gtest/gtest.h>
+
+namespace NetworKit {
+
+class ComponentsBenchmark : public testing::Test {
+public:
+	ComponentsBenchmark() = default;
+	virtual ~ComponentsBenchmark() = default;
+};
+
+} /* namespace NetworKit */
+
+#endif /* COMPONENTSBENCHMARK_H_ */
+
+#endif /* NOGTEST */
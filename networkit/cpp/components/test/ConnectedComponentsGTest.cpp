@@ -10,13 +10,18 @@
 
 #include "../ConnectedComponents.h"
 #include "../ParallelConnectedComponents.h"
+#include "../AfforestConnectedComponents.h"
 #include "../StronglyConnectedComponents.h"
 
 #include "../../distance/Diameter.h"
 #include "../../io/METISGraphReader.h"
+#include "../../io/EdgeListReader.h"
+#include "../../io/KONECTGraphReader.h"
 #include "../../generators/HavelHakimiGenerator.h"
 #include "../../auxiliary/Log.h"
+#include "../../auxiliary/Random.h"
 #include "../../generators/DorogovtsevMendesGenerator.h"
+#include "../../generators/ErdosRenyiGenerator.h"
 
 namespace NetworKit {
 
@@ -84,6 +89,44 @@ TEST_F(ConnectedComponentsGTest, testParallelConnectedComponents) {
 	}
 }
 
+TEST_F(ConnectedComponentsGTest, testAfforestConnectedComponents) {
+	METISGraphReader reader;
+	std::vector<Graph> graphs;
+	for (auto graphName : {"astro-ph", "PGPgiantcompo", "celegans_metabolic", "hep-th", "jazz"}) {
+		graphs.push_back(reader.read(std::string("input/") + graphName + ".graph"));
+	}
+
+	// sparse random graph with many small components
+	graphs.push_back(ErdosRenyiGenerator(20000, 0.00008).generate());
+
+	// long paths with a few deleted nodes, label propagation would need many rounds here
+	Graph path(100000);
+	for (node u = 0; u + 1 < path.upperNodeIdBound(); ++u) {
+		path.addEdge(u, u + 1);
+	}
+	for (node u = 5000; u < path.upperNodeIdBound(); u += 25000) {
+		path.forNeighborsOf(u, [&](node v) {
+			path.removeEdge(u, v);
+		});
+		path.removeNode(u);
+	}
+	graphs.push_back(path);
+
+	for (const Graph& G : graphs) {
+		ConnectedComponents cc(G);
+		cc.run();
+		AfforestConnectedComponents afforest(G);
+		afforest.run();
+
+		EXPECT_EQ(cc.numberOfComponents(), afforest.numberOfComponents());
+		Partition expected = cc.getPartition();
+		Partition actual = afforest.getPartition();
+		G.forNodes([&](node u) {
+			EXPECT_EQ(expected[u], actual[u]);
+		});
+	}
+}
+
 TEST_F(ConnectedComponentsGTest, testParallelConnectedComponentsWithDeletedNodes) {
     Graph G(100);
     G.forNodePairs([&](node u, node v){
@@ -183,6 +226,79 @@ TEST_F(ConnectedComponentsGTest, testStronglyConnectedComponents) {
     p_actual.compact();
 
     comparePartitions(p_expected, p_actual);
+
+    scc.runParallel();
+    p_actual = scc.getPartition();
+    p_actual.compact();
+    comparePartitions(p_expected, p_actual);
+}
+
+TEST_F(ConnectedComponentsGTest, testParallelStronglyConnectedComponents) {
+	std::vector<Graph> graphs;
+	graphs.push_back(EdgeListReader('\t', 0, "#", false, true).read("input/wiki-Vote.txt"));
+	graphs.push_back(KONECTGraphReader(' ').read("input/foodweb-baydry.konect"));
+	for (count outDegree : {1, 2, 4}) {
+		Graph G(5000, false, true);
+		G.forNodes([&](node u) {
+			for (index i = 0; i < outDegree; ++i) {
+				G.addEdge(u, Aux::Random::integer(G.upperNodeIdBound() - 1));
+			}
+		});
+		graphs.push_back(G);
+	}
+
+	// a long cycle with chords backwards and some deleted nodes, which splits it into many components
+	Graph cycle(5000, false, true);
+	for (node u = 0; u < cycle.upperNodeIdBound(); ++u) {
+		cycle.addEdge(u, (u + 1) % cycle.upperNodeIdBound());
+		if (u % 7 == 0 && u >= 100) {
+			cycle.addEdge(u, u - 100);
+		}
+	}
+	for (node u = 234; u < cycle.upperNodeIdBound(); u += 1001) {
+		cycle.forNeighborsOf(u, [&](node v) {
+			cycle.removeEdge(u, v);
+		});
+		cycle.forInEdgesOf(u, [&](node, node v) {
+			cycle.removeEdge(v, u);
+		});
+		cycle.removeNode(u);
+	}
+	graphs.push_back(cycle);
+
+	// the ids start at 1 and each edge between components leads to the smaller id
+	auto checkOrder = [](const Graph& G, const Partition& p, count number) {
+		G.forNodes([&](node u) {
+			EXPECT_GE(p[u], 1u);
+			EXPECT_LE(p[u], number);
+		});
+		G.forEdges([&](node u, node v) {
+			EXPECT_LE(p[v], p[u]);
+		});
+	};
+
+	for (const Graph& G : graphs) {
+		StronglyConnectedComponents scc(G, false);
+		scc.run();
+		Partition expected = scc.getPartition();
+		count expectedNumber = scc.numberOfComponents();
+		checkOrder(G, expected, expectedNumber);
+
+		scc.runIteratively();
+		checkOrder(G, scc.getPartition(), scc.numberOfComponents());
+
+		scc.runParallel();
+		EXPECT_EQ(expectedNumber, scc.numberOfComponents());
+		Partition actual = scc.getPartition();
+		checkOrder(G, actual, expectedNumber);
+
+		// the same components, possibly with other ids
+		expected.compact(true);
+		actual.compact(true);
+		G.forNodes([&](node u) {
+			EXPECT_EQ(expected[u], actual[u]);
+		});
+	}
 }
 
 
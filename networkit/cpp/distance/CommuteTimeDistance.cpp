@@ -82,8 +82,10 @@ void CommuteTimeDistance::runApproximation() {
 	solutions.clear();
 	solutions.resize(k, Vector(n));
 
+	std::vector<Vector> rhs;
+	std::vector<Vector> block;
 	for (index i = 0; i < k; ++i) {
-		Vector rhs(n, 0.0);
+		rhs.emplace_back(n, 0.0);
 
 		// matrix vector product of q
 		// rhs(v) = \sum_e=1 ^m q(e) * B(e, v)
@@ -92,16 +94,23 @@ void CommuteTimeDistance::runApproximation() {
 			double r = randTab[Aux::Random::integer(1)];
 
 			if (u < v) {
-				rhs[u] += r;
-				rhs[v] -= r;
+				rhs.back()[u] += r;
+				rhs.back()[v] -= r;
 			}
 			else {
-				rhs[u] -= r;
-				rhs[v] += r;
+				rhs.back()[u] -= r;
+				rhs.back()[v] += r;
 			}
 		});
 
-		lamg.solve(rhs, solutions[i]);
+		// solve the right-hand sides in blocks of SOLVE_BLOCK_SIZE
+		if (rhs.size() == SOLVE_BLOCK_SIZE || i + 1 == k) {
+			index first = i + 1 - rhs.size();
+			block.assign(solutions.begin() + first, solutions.begin() + i + 1);
+			lamg.solveBlock(rhs, block);
+			std::move(block.begin(), block.end(), solutions.begin() + first);
+			rhs.clear();
+		}
 
 		// G.forNodePairs([&](node u, node v){
 		// 		double diff = solutions[i][u] - solutions[i][v];
@@ -11,13 +11,15 @@
 #include "Eccentricity.h"
 #include "../graph/BFS.h"
 #include "../graph/Dijkstra.h"
+#include "../graph/DirOptBFS.h"
+#include "../graph/MultiSourceBFS.h"
 #include "../components/ConnectedComponents.h"
 #include "../structures/Partition.h"
 #include "../graph/BFS.h"
 
 namespace NetworKit {
 
-Diameter::Diameter(const Graph& G, DiameterAlgo algo, double error, count nSamples) : Algorithm(), G(G), error(error), nSamples(nSamples) {
+Diameter::Diameter(const Graph& G, DiameterAlgo algo, double error, count nSamples, bool parallelBFS) : Algorithm(), G(G), error(error), nSamples(nSamples), parallelBFS(parallelBFS) {
 	if (algo == DiameterAlgo::automatic) {
 		this->algo = DiameterAlgo::exact;
 	} else {
@@ -235,36 +237,62 @@ edgeweight Diameter::estimatedVertexDiameter(const Graph& G, count samples) {
 
 	// TODO: consider weights
 
-	auto estimateFrom = [&](node v) -> count {
-		BFS bfs(G, v);
-		bfs.run();
-		auto distances = bfs.getDistances();
-
-		// get two largest path lengths
-		edgeweight maxD = 0;
-		edgeweight maxD2 = 0; // second largest distance
-		for (auto d : distances) {
-			if ((d != infDist) && (d >= maxD)) {
-				maxD2 = maxD;
-				maxD = d;
+	edgeweight vdMax = 0;
+	if (parallelBFS) {
+		// every BFS is parallel by itself, so the samples are processed one after another
+		for (count i = 0; i < samples; ++i) {
+			node u = G.randomNode();
+			DirOptBFS bfs(G, u, false);
+			bfs.run();
+
+			// get two largest path lengths
+			edgeweight maxD = 0;
+			edgeweight maxD2 = 0; // second largest distance
+			for (auto d : bfs.getDistances()) {
+				if ((d != infDist) && (d >= maxD)) {
+					maxD2 = maxD;
+					maxD = d;
+				}
 			}
-		}
 
-		edgeweight dMax = maxD + maxD2;
-		count vd = (count) dMax + 1; 	// count the nodes, not the edges
-		return vd;
-	};
+			edgeweight vd = maxD + maxD2 + 1; 	// count the nodes, not the edges
+			DEBUG("sampled vertex diameter from node ", u, ": ", vd);
+			vdMax = std::max(vdMax, vd);
+		}
+		return vdMax;
+	}
 
-	edgeweight vdMax = 0;
-	#pragma omp parallel for
+	// bit-parallel BFSs from batches of 64 samples
+	std::vector<node> sampled(samples);
 	for (count i = 0; i < samples; ++i) {
-		node u = G.randomNode();
-		edgeweight vd = estimateFrom(u);
-		DEBUG("sampled vertex diameter from node ", u, ": ", vd);
-		#pragma omp critical
-		{
-			if (vd > vdMax) {
-				vdMax = vd;
+		sampled[i] = G.randomNode();
+	}
+	const count batchSize = MultiSourceBFS::maxSources;
+	const count numberOfBatches = (samples + batchSize - 1) / batchSize;
+	#pragma omp parallel
+	{
+		MultiSourceBFS msbfs(G);
+		#pragma omp for schedule(dynamic, 1)
+		for (index batch = 0; batch < numberOfBatches; ++batch) {
+			std::vector<node> sources(sampled.begin() + batch * batchSize, sampled.begin() + std::min((batch + 1) * batchSize, samples));
+			// the two largest path lengths per source; distances arrive in nondecreasing order
+			std::vector<count> maxD(sources.size(), 0);
+			std::vector<count> maxD2(sources.size(), 0);
+			msbfs.run(sources, [&](node, count dist, uint64_t newSources) {
+				MultiSourceBFS::forSources(newSources, [&](index i) {
+					maxD2[i] = maxD[i];
+					maxD[i] = dist;
+				});
+			});
+			for (index i = 0; i < sources.size(); ++i) {
+				edgeweight vd = maxD[i] + maxD2[i] + 1; 	// count the nodes, not the edges
+				DEBUG("sampled vertex diameter from node ", sources[i], ": ", vd);
+				#pragma omp critical
+				{
+					if (vd > vdMax) {
+						vdMax = vd;
+					}
+				}
 			}
 		}
 	}
@@ -23,7 +23,11 @@ class Diameter : public Algorithm {
 
 public:
 	
-	Diameter(const Graph& G, DiameterAlgo algo = DiameterAlgo::automatic, double error = -1.f, count nSamples = 0);
+	/**
+	 * @param parallelBFS If true, the sampling-based estimate runs each BFS with the
+	 * parallel direction-optimizing DirOptBFS instead of running sequential BFSs in parallel.
+	 */
+	Diameter(const Graph& G, DiameterAlgo algo = DiameterAlgo::automatic, double error = -1.f, count nSamples = 0, bool parallelBFS = false);
 
 	void run() override;
 
@@ -37,6 +41,7 @@ private:
 	DiameterAlgo algo;
 	double error;
 	count nSamples;
+	bool parallelBFS;
 	std::pair<count, count> diameterBounds;
 
 	/**
@@ -7,12 +7,19 @@
 
 #include "Eccentricity.h"
 #include "../graph/BFS.h"
+#include "../graph/DirOptBFS.h"
 
 namespace NetworKit {
 
-std::pair<node, count> Eccentricity::getValue(const Graph& G, node u) {
+std::pair<node, count> Eccentricity::getValue(const Graph& G, node u, bool parallel) {
 	count ecc = 0;
 	node res;
+	if (parallel) {
+		DirOptBFS bfs(G, u, false, true);
+		bfs.run();
+		res = bfs.getStack().back();
+		return {res, (count) bfs.distance(res)};
+	}
 	G.BFSfrom(u, [&](node v, count dist) {
 		ecc = dist;
 		res = v;
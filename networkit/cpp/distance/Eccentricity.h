@@ -21,8 +21,10 @@ public:
 
 	/**
 	 * TODO: documentation
+	 *
+	 * @param parallel use the parallel direction-optimizing BFS (DirOptBFS) instead of a sequential BFS
 	 */
-	static std::pair<node, count> getValue(const Graph& G, node u);
+	static std::pair<node, count> getValue(const Graph& G, node u, bool parallel = false);
 };
 
 } /* namespace NetworKit */
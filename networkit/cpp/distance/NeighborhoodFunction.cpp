@@ -8,6 +8,7 @@
 #include "NeighborhoodFunction.h"
 #include "../components/ConnectedComponents.h"
 #include "../auxiliary/Random.h"
+#include "../graph/MultiSourceBFS.h"
 
 #include <math.h>
 #include <iterator>
@@ -27,12 +28,22 @@ NeighborhoodFunction::NeighborhoodFunction(const Graph& G) : Algorithm(), G(G) {
 void NeighborhoodFunction::run() {
 	count max_threads = (count)omp_get_max_threads();
 	std::vector<std::map<count, count>> nf(max_threads);
-	G.parallelForNodes([&](node u){
+	// bit-parallel BFSs from batches of 64 sources; every set bit is one (source, node) pair at distance dist
+	std::vector<node> nodes = G.nodes();
+	const count batchSize = MultiSourceBFS::maxSources;
+	const count numberOfBatches = (nodes.size() + batchSize - 1) / batchSize;
+	#pragma omp parallel
+	{
 		index tid = omp_get_thread_num();
-		G.BFSfrom(u, [&](node v, count dist) {
-			nf[tid][dist] += 1;
-		});
-	});
+		MultiSourceBFS msbfs(G);
+		#pragma omp for schedule(dynamic, 1)
+		for (index batch = 0; batch < numberOfBatches; ++batch) {
+			std::vector<node> sources(nodes.begin() + batch * batchSize, nodes.begin() + std::min((batch + 1) * batchSize, (count) nodes.size()));
+			msbfs.run(sources, [&](node, count dist, uint64_t newSources) {
+				nf[tid][dist] += __builtin_popcountll(newSources);
+			});
+		}
+	}
 	count size = 0;
 	for (index i = 0; i < max_threads; ++i) {
 		size = std::max(size, (count)nf[i].size());
@@ -14,9 +14,10 @@
 namespace NetworKit {
 
 /**
- * An implementation of the triangle counting algorithm by Chiba/Nishizeki.
+ * Counts the triangles each edge is part of. Originally an implementation of the triangle counting algorithm by
+ * Chiba/Nishizeki, the counts are now computed by TriangleCounting like in TriangleEdgeScore.
  *
- * @deprecated Use TriangleEdgeScore instead which is parallelized and has a similar performance even in the sequential case.
+ * @deprecated Use TriangleEdgeScore instead.
  */
 class ChibaNishizekiTriangleEdgeScore : public EdgeScore<count> {
 
@@ -13,13 +13,9 @@
 namespace NetworKit {
 
 /**
- * A parallel triangle counting implementation based on ideas in [0].
- *
- * This implementation avoids less work but needs therefore also less checks and
- * is (apart from a fast initialization) parallel without any locks. In experiments
- * this implementation seems to be fast both in non-parallel as well as in parallel
- * settings. With only one thread its performance is similar to the sequential
- * ChibaNishizekiTriangleEdgeScore in NetworKit.
+ * Counts the triangles each edge is part of. The counts are computed by TriangleCounting, which orients the edges
+ * by degree as proposed in [0] and intersects sorted neighbor lists in parallel without locks. The graph must be
+ * undirected, run() throws on directed graphs.
  *
  * [0] Triangle Listing Algorithms: Back from the Diversion
  * Mark Ortmann and Ulrik Brandes                                                                          *
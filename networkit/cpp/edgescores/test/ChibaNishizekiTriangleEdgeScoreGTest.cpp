@@ -51,6 +51,18 @@ TEST_F(ChibaNishizekiTriangleEdgeScoreGTest, testNewTriangleCountsTrivial) {
 	//TODO: edge ids for non-existing edges currently result in unexpected behaviour.
 }
 
+TEST_F(ChibaNishizekiTriangleEdgeScoreGTest, testNewTriangleCountsDirected) {
+	Graph g(3, false, true);
+
+	g.addEdge(0,1);
+	g.addEdge(0,2);
+	g.addEdge(1,2);
+
+	g.indexEdges();
+
+	TriangleEdgeScore counter(g);
+	EXPECT_THROW(counter.run(), std::runtime_error);
+}
 
 TEST_F(ChibaNishizekiTriangleEdgeScoreGTest, testTriangleCountsSimple) {
 	int64_t n = 6;
@@ -0,0 +1,439 @@
+/*
+ * PushRelabel.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: NetworKit contributors
+ */
+
+#include "PushRelabel.h"
+#include "../auxiliary/SignalHandling.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <queue>
+#include <stdexcept>
+
+namespace NetworKit {
+
+PushRelabel::PushRelabel(const Graph &graph, node source, node sink, bool parallel) : graph(graph), source(source), sink(sink), parallel(parallel), flowValue(0) {
+	if (source == sink) {
+		throw std::runtime_error("source and sink must be different nodes");
+	}
+}
+
+void PushRelabel::buildResidualNetwork() {
+	const count z = graph.upperNodeIdBound();
+	const bool directed = graph.isDirected();
+
+	// each edge gives an arc at both endpoints, for directed edges the reverse arc has no capacity
+	arcBegin.assign(z + 1, 0);
+	graph.parallelForNodes([&](node u) {
+		count arcs = 0;
+		graph.forNeighborsOf(u, [&](node v) {
+			arcs += (v != u);
+		});
+		if (directed) {
+			graph.forInNeighborsOf(u, [&](node v) {
+				arcs += (v != u);
+			});
+		}
+		arcBegin[u + 1] = arcs;
+	});
+	for (index u = 0; u < z; ++u) {
+		arcBegin[u + 1] += arcBegin[u];
+	}
+
+	const count m = arcBegin[z];
+	head.resize(m);
+	reverse.resize(m);
+	capacity.resize(m);
+
+	edgeArc.assign(2 * graph.upperEdgeIdBound(), none);
+	graph.balancedParallelForNodes([&](node u) {
+		index a = arcBegin[u];
+		graph.forNeighborsOf(u, [&](node, node v, edgeweight w, edgeid eid) {
+			if (v == u) {
+				return;
+			}
+			head[a] = v;
+			capacity[a] = w;
+			edgeArc[2 * eid + ((directed || u < v) ? 0 : 1)] = a;
+			++a;
+		});
+		if (directed) {
+			graph.forInEdgesOf(u, [&](node, node v, edgeweight, edgeid eid) {
+				if (v == u) {
+					return;
+				}
+				head[a] = v;
+				capacity[a] = 0;
+				edgeArc[2 * eid + 1] = a;
+				++a;
+			});
+		}
+	});
+
+#pragma omp parallel for
+	for (index e = 0; e < graph.upperEdgeIdBound(); ++e) {
+		if (edgeArc[2 * e] != none) {
+			reverse[edgeArc[2 * e]] = edgeArc[2 * e + 1];
+			reverse[edgeArc[2 * e + 1]] = edgeArc[2 * e];
+		}
+	}
+}
+
+std::vector<node> PushRelabel::globalRelabel(node target, count bound) {
+	const count z = graph.upperNodeIdBound();
+	std::fill(label.begin(), label.end(), bound);
+
+	// breadth-first search from the target along reversed residual arcs
+	std::queue<node> Q;
+	label[target] = 0;
+	Q.push(target);
+	const node other = (target == sink) ? source : sink;
+	while (!Q.empty()) {
+		node x = Q.front(); Q.pop();
+		for (index a = arcBegin[x]; a < arcBegin[x + 1]; ++a) {
+			const node y = head[a];
+			if (residual[reverse[a]] > 0 && label[y] == bound && y != other && y != target) {
+				label[y] = label[x] + 1;
+				Q.push(y);
+			}
+		}
+	}
+
+	std::vector<node> active;
+	for (node u = 0; u < z; ++u) {
+		if (excess[u] > 0 && label[u] < bound && u != source && u != sink) {
+			active.push_back(u);
+		}
+	}
+
+	return active;
+}
+
+void PushRelabel::discharge(node target, count bound, bool gap, const std::vector<node>& active) {
+	Aux::SignalHandler handler;
+	const count z = graph.upperNodeIdBound();
+	const count relabelWork = graph.numberOfNodes() + head.size();
+
+	std::vector<char> queued(z, 0);
+	std::vector<index> current(arcBegin.begin(), arcBegin.end() - 1);
+	std::vector<count> labelCount(bound + 1, 0);
+	std::queue<node> Q;
+	for (node u : active) {
+		Q.push(u);
+		queued[u] = 1;
+	}
+	graph.forNodes([&](node u) {
+		++labelCount[label[u]];
+	});
+	count work = 0;
+
+	while (true) {
+		if (work > relabelWork) {
+			handler.assureRunning();
+			Q = std::queue<node>();
+			std::fill(queued.begin(), queued.end(), 0);
+			for (node u : globalRelabel(target, bound)) {
+				Q.push(u);
+				queued[u] = 1;
+			}
+			std::copy(arcBegin.begin(), arcBegin.end() - 1, current.begin());
+			std::fill(labelCount.begin(), labelCount.end(), 0);
+			graph.forNodes([&](node u) {
+				++labelCount[label[u]];
+			});
+			work = 0;
+		}
+		if (Q.empty()) {
+			break;
+		}
+
+		const node v = Q.front(); Q.pop();
+		queued[v] = 0;
+
+		while (excess[v] > 0 && label[v] < bound) {
+			// push along the admissible arcs, starting at the current arc
+			for (; current[v] < arcBegin[v + 1]; ++current[v]) {
+				const index a = current[v];
+				const node w = head[a];
+				if (residual[a] > 0 && label[v] == label[w] + 1) {
+					const edgeweight delta = std::min(excess[v], residual[a]);
+					residual[a] -= delta;
+					residual[reverse[a]] += delta;
+					excess[v] -= delta;
+					excess[w] += delta;
+					if (!queued[w] && w != source && w != sink) {
+						Q.push(w);
+						queued[w] = 1;
+						if (!listed[w]) {
+							excessNodes.push_back(w);
+							listed[w] = 1;
+						}
+					}
+					if (excess[v] == 0) {
+						break;
+					}
+				}
+			}
+			if (excess[v] == 0) {
+				break;
+			}
+
+			// relabel: all residual arcs lead to nodes with at least the same label
+			const count oldLabel = label[v];
+			count newLabel = bound;
+			for (index a = arcBegin[v]; a < arcBegin[v + 1]; ++a) {
+				if (residual[a] > 0) {
+					newLabel = std::min(newLabel, label[head[a]] + 1);
+				}
+			}
+			work += arcBegin[v + 1] - arcBegin[v] + 12;
+			label[v] = newLabel;
+			current[v] = arcBegin[v];
+			--labelCount[oldLabel];
+			++labelCount[newLabel];
+
+			// gap: no node with a label above an empty one can reach the target
+			if (gap && labelCount[oldLabel] == 0 && oldLabel + 1 < bound) {
+				work += z;
+				graph.forNodes([&](node u) {
+					if (label[u] > oldLabel && label[u] < bound) {
+						--labelCount[label[u]];
+						++labelCount[bound];
+						label[u] = bound;
+					}
+				});
+			}
+		}
+	}
+}
+
+void PushRelabel::dischargeParallel(node target, count bound, std::vector<node> active) {
+	Aux::SignalHandler handler;
+	const count z = graph.upperNodeIdBound();
+	const count relabelWork = graph.numberOfNodes() + head.size();
+
+	std::vector<std::atomic<char>> queued(z);
+	for (index u = 0; u < z; ++u) {
+		queued[u].store(0, std::memory_order_relaxed);
+	}
+	std::vector<edgeweight> addedExcess(z, 0);
+	std::vector<count> newLabel(z, 0);
+	count work = 0;
+
+	while (true) {
+		if (work > relabelWork) {
+			handler.assureRunning();
+			active = globalRelabel(target, bound);
+			work = 0;
+		}
+		if (active.empty()) {
+			break;
+		}
+
+		// push from all active nodes against the current labels; the reverse arcs and excesses are updated afterwards
+		std::vector<std::pair<index, edgeweight>> pushes;
+		std::vector<node> touched, relabeled;
+		count roundWork = 0;
+#pragma omp parallel reduction(+:roundWork)
+		{
+			std::vector<std::pair<index, edgeweight>> localPushes;
+			std::vector<node> localTouched, localRelabeled;
+
+#pragma omp for schedule(dynamic, 16) nowait
+			for (index i = 0; i < active.size(); ++i) {
+				const node v = active[i];
+				for (index a = arcBegin[v]; a < arcBegin[v + 1] && excess[v] > 0; ++a) {
+					const node w = head[a];
+					if (residual[a] > 0 && label[v] == label[w] + 1) {
+						const edgeweight delta = std::min(excess[v], residual[a]);
+						residual[a] -= delta;
+						excess[v] -= delta;
+						localPushes.emplace_back(a, delta);
+#pragma omp atomic
+						addedExcess[w] += delta;
+						if (!queued[w].exchange(1, std::memory_order_relaxed)) {
+							localTouched.push_back(w);
+						}
+					}
+				}
+
+				if (excess[v] > 0) {
+					localRelabeled.push_back(v);
+					if (!queued[v].exchange(1, std::memory_order_relaxed)) {
+						localTouched.push_back(v);
+					}
+				}
+				roundWork += arcBegin[v + 1] - arcBegin[v];
+			}
+
+#pragma omp critical
+			{
+				pushes.insert(pushes.end(), localPushes.begin(), localPushes.end());
+				touched.insert(touched.end(), localTouched.begin(), localTouched.end());
+				relabeled.insert(relabeled.end(), localRelabeled.begin(), localRelabeled.end());
+			}
+		}
+
+		// each arc is pushed along at most once per round, so each reverse arc has a single writer
+#pragma omp parallel for
+		for (index i = 0; i < pushes.size(); ++i) {
+			residual[reverse[pushes[i].first]] += pushes[i].second;
+		}
+#pragma omp parallel for
+		for (index i = 0; i < touched.size(); ++i) {
+			const node u = touched[i];
+			excess[u] += addedExcess[u];
+			addedExcess[u] = 0;
+		}
+
+		// nodes with excess left have saturated their admissible arcs, so the new labels are higher than the old ones
+#pragma omp parallel for schedule(dynamic, 16) reduction(+:roundWork)
+		for (index i = 0; i < relabeled.size(); ++i) {
+			const node v = relabeled[i];
+			count l = bound;
+			for (index a = arcBegin[v]; a < arcBegin[v + 1]; ++a) {
+				if (residual[a] > 0) {
+					l = std::min(l, label[head[a]] + 1);
+				}
+			}
+			newLabel[v] = l;
+			roundWork += arcBegin[v + 1] - arcBegin[v] + 12;
+		}
+#pragma omp parallel for
+		for (index i = 0; i < relabeled.size(); ++i) {
+			label[relabeled[i]] = newLabel[relabeled[i]];
+		}
+		work += roundWork;
+
+		active.clear();
+		for (node u : touched) {
+			queued[u].store(0, std::memory_order_relaxed);
+			if (!listed[u] && u != source && u != sink) {
+				excessNodes.push_back(u);
+				listed[u] = 1;
+			}
+			if (excess[u] > 0 && label[u] < bound && u != source && u != sink) {
+				active.push_back(u);
+			}
+		}
+	}
+}
+
+void PushRelabel::setTerminals(node source, node sink) {
+	if (source == sink) {
+		throw std::runtime_error("source and sink must be different nodes");
+	}
+	this->source = source;
+	this->sink = sink;
+}
+
+void PushRelabel::run() {
+	if (!graph.hasEdgeIds()) { throw std::runtime_error("edges have not been indexed - call indexEdges first"); }
+	const count z = graph.upperNodeIdBound();
+	const count n = graph.numberOfNodes();
+
+	if (arcBegin.empty()) {
+		buildResidualNetwork();
+	}
+	residual = capacity;
+	excess.assign(z, 0);
+	listed.assign(z, 0);
+	excessNodes.clear();
+
+	// saturate the arcs out of the source
+	for (index a = arcBegin[source]; a < arcBegin[source + 1]; ++a) {
+		const node w = head[a];
+		const edgeweight delta = residual[a];
+		if (delta <= 0) {
+			continue;
+		}
+		residual[a] = 0;
+		residual[reverse[a]] += delta;
+		excess[w] += delta;
+		excess[source] -= delta;
+		if (!listed[w] && w != sink) {
+			excessNodes.push_back(w);
+			listed[w] = 1;
+		}
+	}
+
+	// phase 1: maximum preflow. All-zero labels are valid, so the first global relabeling is deferred like the
+	// later ones; if the flow only touches a small part of the graph, it never happens.
+	label.assign(z, 0);
+	label[source] = n;
+	std::vector<node> active = excessNodes;
+	if (parallel) {
+		dischargeParallel(sink, n, active);
+	} else {
+		discharge(sink, n, true, active);
+	}
+	flowValue = excess[sink];
+
+	// phase 2: return the excess of the nodes that cannot reach the sink to the source
+	std::fill(label.begin(), label.end(), 0);
+	label[sink] = 2 * n;
+	active.clear();
+	for (node u : excessNodes) {
+		if (excess[u] > 0) {
+			active.push_back(u);
+		}
+	}
+	if (parallel) {
+		dischargeParallel(source, 2 * n, active);
+	} else {
+		discharge(source, 2 * n, false, active);
+	}
+
+	// the flow of an undirected edge is half the difference of the residual capacities of its arcs
+	const bool directed = graph.isDirected();
+	flow.assign(graph.upperEdgeIdBound(), 0.0);
+#pragma omp parallel for
+	for (index e = 0; e < graph.upperEdgeIdBound(); ++e) {
+		if (edgeArc[2 * e] != none) {
+			const index a = edgeArc[2 * e], b = edgeArc[2 * e + 1];
+			flow[e] = directed ? residual[b] : std::abs(residual[b] - residual[a]) / 2;
+		}
+	}
+}
+
+edgeweight PushRelabel::getMaxFlow() const {
+	return flowValue;
+}
+
+std::vector<node> PushRelabel::getSourceSet() const {
+	// perform bfs from source in the residual network
+	std::vector<bool> visited(graph.upperNodeIdBound(), false);
+	std::vector<node> sourceSet;
+
+	std::queue<node> Q;
+	Q.push(source);
+	visited[source] = true;
+	while (!Q.empty()) {
+		node u = Q.front(); Q.pop();
+		sourceSet.push_back(u);
+
+		for (index a = arcBegin[u]; a < arcBegin[u + 1]; ++a) {
+			const node v = head[a];
+			if (!visited[v] && residual[a] > 0) {
+				Q.push(v);
+				visited[v] = true;
+			}
+		}
+	}
+
+	return sourceSet;
+}
+
+edgeweight PushRelabel::getFlow(node u, node v) const {
+	return flow[graph.edgeId(u, v)];
+}
+
+std::vector<edgeweight> PushRelabel::getFlowVector() const {
+	return flow;
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,146 @@
+/*
+ * PushRelabel.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef PUSHRELABEL_H_
+#define PUSHRELABEL_H_
+
+#include "../graph/Graph.h"
+#include <vector>
+
+namespace NetworKit {
+
+/**
+ * @ingroup flow
+ * The PushRelabel class implements the push-relabel maximum flow algorithm by Goldberg and Tarjan with the global
+ * relabeling and gap heuristics. It has the same interface as EdmondsKarp. Undirected edges carry flow in either
+ * direction up to their weight, directed edges only in their direction.
+ *
+ * The residual network is stored once in CSR format, each arc next to the index of its reverse arc. The first phase
+ * computes a maximum preflow; the second phase returns the excess that cannot reach the sink to the source, so that
+ * the result is a flow. In each phase, the labels are periodically recomputed exactly by a breadth-first search from
+ * the target (global relabeling), which also removes nodes that cannot reach it. The phases start from all-zero labels
+ * and relabel globally only after work proportional to the size of the graph, so small flows stay local. Unlike with
+ * EdmondsKarp, the flow may contain cycles.
+ *
+ * The sequential variant discharges active nodes in FIFO order and applies the gap heuristic after each relabel. The
+ * parallel variant is synchronous (Jacobi style): in each round, all active nodes push along their admissible arcs
+ * against a snapshot of the labels, the reverse residual capacities and excesses are applied afterwards, and nodes
+ * with remaining excess are relabeled from the old labels. Here the gaps are found by the global relabeling.
+ */
+class PushRelabel {
+public:
+	/**
+	 * Constructs an instance of the push-relabel algorithm for the given graph, source and sink.
+	 * @param graph The graph, its edges must be indexed.
+	 * @param source The source node.
+	 * @param sink The sink node.
+	 * @param parallel Use the synchronous parallel variant.
+	 */
+	PushRelabel(const Graph &graph, node source, node sink, bool parallel = false);
+
+	/**
+	 * Computes the maximum flow.
+	 */
+	void run();
+
+	/**
+	 * Changes the source and the sink for the next run(), which then reuses the residual network of the previous one.
+	 * Use this to compute many flows in the same graph, e.g. for cut trees.
+	 *
+	 * @param source The source node.
+	 * @param sink The sink node.
+	 */
+	void setTerminals(node source, node sink);
+
+	/**
+	 * Returns the value of the maximum flow from source to sink.
+	 *
+	 * @return The maximum flow value
+	 */
+	edgeweight getMaxFlow() const;
+
+	/**
+	 * Returns the set of the nodes on the source side of the flow/minimum cut.
+	 *
+	 * @return The set of nodes that form the (smallest) source side of the flow/minimum cut.
+	 */
+	std::vector<node> getSourceSet() const;
+
+	/**
+	 * Get the flow value between two nodes @a u and @a v.
+	 * @warning The running time of this function is linear in the degree of u.
+	 *
+	 * @param u The first node
+	 * @param v The second node
+	 * @return The flow between node u and v.
+	 */
+	edgeweight getFlow(node u, node v) const;
+
+	/**
+	 * Get the flow value of an edge.
+	 *
+	 * @param eid The id of the edge
+	 * @return The flow on the edge identified by eid
+	 */
+	edgeweight getFlow(edgeid eid) const {
+		return flow[eid];
+	};
+
+	/**
+	 * Return a copy of the flow values of all edges.
+	 * @note Instead of copying all values you can also use the inline function "getFlow(edgeid)" in order to access the values efficiently.
+	 *
+	 * @return The flow values of all edges
+	 */
+	std::vector<edgeweight> getFlowVector() const;
+
+private:
+	const Graph &graph;
+
+	node source;
+	node sink;
+	bool parallel;
+
+	std::vector<edgeweight> flow;
+	edgeweight flowValue;
+
+	// residual network in CSR format
+	std::vector<index> arcBegin;
+	std::vector<node> head;
+	std::vector<index> reverse;
+	std::vector<edgeweight> capacity;
+	std::vector<edgeweight> residual;
+	std::vector<index> edgeArc; // the arcs of edge e at 2 * e (from the smaller node or the tail) and 2 * e + 1
+
+	std::vector<edgeweight> excess;
+	std::vector<count> label;
+	std::vector<node> excessNodes; // the nodes that received excess in the current run
+	std::vector<char> listed;
+
+	/**
+	 * Builds the residual network of the graph without flow.
+	 */
+	void buildResidualNetwork();
+
+	/**
+	 * Sets each label to the distance to @a target in the residual network, or to @a bound if @a target cannot be
+	 * reached. The terminal that is not the target gets the label @a bound.
+	 * @return The nodes with excess and a label below @a bound.
+	 */
+	std::vector<node> globalRelabel(node target, count bound);
+
+	/**
+	 * Discharges the @a active nodes and the nodes they push to until no node with excess has a label below @a bound.
+	 */
+	void discharge(node target, count bound, bool gap, const std::vector<node>& active);
+
+	void dischargeParallel(node target, count bound, std::vector<node> active);
+};
+
+} /* namespace NetworKit */
+
+#endif /* PUSHRELABEL_H_ */
@@ -0,0 +1,226 @@
+/*
+ * PushRelabelGTest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: NetworKit contributors
+ */
+
+#include "PushRelabelGTest.h"
+#include "../EdmondsKarp.h"
+#include "../../generators/ErdosRenyiGenerator.h"
+#include "../../auxiliary/Random.h"
+
+#include <algorithm>
+
+namespace NetworKit {
+
+/**
+ * Checks the capacities and that the source set is a cut of the size of the flow. On directed graphs, also checks
+ * the conservation of the flow vector; the flow values of undirected edges do not carry their direction.
+ */
+static void checkFlow(const Graph& G, const PushRelabel& flow, node source, node sink) {
+	G.forEdges([&](node u, node v, edgeweight w, edgeid eid) {
+		EXPECT_LE(flow.getFlow(eid), w + 1e-9);
+		EXPECT_GE(flow.getFlow(eid), 0.0);
+	});
+
+	if (G.isDirected()) {
+		std::vector<edgeweight> flowVector = flow.getFlowVector();
+		ASSERT_EQ(G.upperEdgeIdBound(), flowVector.size());
+		std::vector<edgeweight> netOutflow(G.upperNodeIdBound(), 0.0);
+		G.forEdges([&](node u, node v, edgeid eid) {
+			netOutflow[u] += flowVector[eid];
+			netOutflow[v] -= flowVector[eid];
+		});
+		G.forNodes([&](node u) {
+			edgeweight expected = u == source ? flow.getMaxFlow() : (u == sink ? -flow.getMaxFlow() : 0.0);
+			EXPECT_NEAR(expected, netOutflow[u], 1e-9) << "node " << u;
+		});
+	}
+
+	std::vector<node> sourceSet = flow.getSourceSet();
+	std::vector<bool> inSourceSet(G.upperNodeIdBound(), false);
+	for (node u : sourceSet) {
+		inSourceSet[u] = true;
+	}
+	EXPECT_TRUE(inSourceSet[source]);
+	EXPECT_FALSE(inSourceSet[sink]);
+
+	edgeweight cut = 0;
+	G.forEdges([&](node u, node v, edgeweight w) {
+		if (inSourceSet[u] != inSourceSet[v] && (!G.isDirected() || inSourceSet[u])) {
+			cut += w;
+		}
+	});
+	EXPECT_NEAR(flow.getMaxFlow(), cut, 1e-9);
+}
+
+/**
+ * Replaces each edge of the undirected graph @a G by two opposite arcs of the same capacity. The maximum flow stays
+ * the same, and the flow vector of the result shows the direction of the flow, so its conservation can be checked.
+ */
+static Graph bidirected(const Graph& G) {
+	Graph D(G.upperNodeIdBound(), true, true);
+	G.forEdges([&](node u, node v, edgeweight w) {
+		D.addEdge(u, v, w);
+		D.addEdge(v, u, w);
+	});
+	D.indexEdges();
+	return D;
+}
+
+TEST_F(PushRelabelGTest, testPushRelabelP1) {
+	Graph G(7, false);
+	G.addEdge(0,1);
+	G.addEdge(0,2);
+	G.addEdge(0,3);
+	G.addEdge(1,2);
+	G.addEdge(1,4);
+	G.addEdge(2,3);
+	G.addEdge(2,4);
+	G.addEdge(3,4);
+	G.addEdge(3,5);
+	G.addEdge(4,6);
+	G.addEdge(5,6);
+
+	G.indexEdges();
+
+	for (bool parallel : {false, true}) {
+		PushRelabel pr(G, 0, 6, parallel);
+		pr.run();
+		EXPECT_EQ(2, pr.getMaxFlow()) << "max flow is not correct";
+
+		EXPECT_EQ(1, pr.getFlow(4, 6));
+		EXPECT_EQ(1, pr.getFlow(5, 6));
+
+		std::vector<node> sourceSet(pr.getSourceSet());
+		std::sort(sourceSet.begin(), sourceSet.end());
+		EXPECT_EQ(std::vector<node>({0, 1, 2, 3, 4}), sourceSet);
+		checkFlow(G, pr, 0, 6);
+
+		Graph D = bidirected(G);
+		PushRelabel directed(D, 0, 6, parallel);
+		directed.run();
+		EXPECT_EQ(2, directed.getMaxFlow());
+		checkFlow(D, directed, 0, 6);
+	}
+}
+
+TEST_F(PushRelabelGTest, testPushRelabelP2) {
+	Graph G(6, true);
+	G.addEdge(0,1, 5);
+	G.addEdge(0,2, 15);
+	G.addEdge(1,3, 5);
+	G.addEdge(1,4, 5);
+	G.addEdge(2,3, 5);
+	G.addEdge(2, 4, 5);
+	G.addEdge(3,5, 15);
+	G.addEdge(4,5, 5);
+
+	G.indexEdges();
+
+	for (bool parallel : {false, true}) {
+		PushRelabel pr(G, 0, 5, parallel);
+		pr.run();
+		EXPECT_EQ(15, pr.getMaxFlow()) << "max flow is not correct";
+		checkFlow(G, pr, 0, 5);
+
+		Graph D = bidirected(G);
+		PushRelabel directed(D, 0, 5, parallel);
+		directed.run();
+		EXPECT_EQ(15, directed.getMaxFlow());
+		checkFlow(D, directed, 0, 5);
+	}
+}
+
+TEST_F(PushRelabelGTest, testPushRelabelUnconnected) {
+	Graph G(6, true);
+	G.addEdge(0,1, 5);
+	G.addEdge(0,2, 15);
+	G.addEdge(1,2, 5);
+	G.addEdge(3, 4, 5);
+	G.addEdge(3,5, 15);
+	G.addEdge(4,5, 5);
+
+	G.indexEdges();
+
+	for (bool parallel : {false, true}) {
+		PushRelabel pr(G, 0, 5, parallel);
+		pr.run();
+		EXPECT_EQ(0, pr.getMaxFlow()) << "max flow is not correct";
+		checkFlow(G, pr, 0, 5);
+
+		std::vector<node> sourceSet(pr.getSourceSet());
+		std::sort(sourceSet.begin(), sourceSet.end());
+		EXPECT_EQ(std::vector<node>({0, 1, 2}), sourceSet);
+	}
+}
+
+TEST_F(PushRelabelGTest, testPushRelabelDirected) {
+	// the edge (3, 2) can only be used in its direction
+	Graph G(5, true, true);
+	G.addEdge(0, 1, 3);
+	G.addEdge(0, 3, 2);
+	G.addEdge(1, 2, 1);
+	G.addEdge(3, 2, 4);
+	G.addEdge(2, 4, 5);
+	G.addEdge(1, 4, 1);
+	G.addEdge(4, 3, 7);
+
+	G.indexEdges();
+
+	for (bool parallel : {false, true}) {
+		PushRelabel pr(G, 0, 4, parallel);
+		pr.run();
+		EXPECT_EQ(4, pr.getMaxFlow());
+		EXPECT_EQ(0, pr.getFlow(4, 3));
+		EXPECT_EQ(2, pr.getFlow(3, 2));
+		checkFlow(G, pr, 0, 4);
+	}
+}
+
+TEST_F(PushRelabelGTest, testPushRelabelRandom) {
+	for (count n : {20, 300, 2000}) {
+		Graph U = ErdosRenyiGenerator(n, 8.0 / n).generate();
+		Graph G(U, true, false);
+		// integral weights, so that the flow values compare exactly
+		G.forEdges([&](node u, node v) {
+			G.setWeight(u, v, (double) Aux::Random::integer(1, 10));
+		});
+		G.indexEdges();
+		Graph D = bidirected(G);
+
+		// one instance for all terminals, which reuses its residual network
+		PushRelabel reused(G, 0, 1);
+
+		for (index i = 0; i < 3; ++i) {
+			const node s = G.randomNode();
+			node t = G.randomNode();
+			while (t == s) {
+				t = G.randomNode();
+			}
+
+			EdmondsKarp ek(G, s, t);
+			ek.run();
+
+			for (bool parallel : {false, true}) {
+				PushRelabel pr(G, s, t, parallel);
+				pr.run();
+				EXPECT_EQ(ek.getMaxFlow(), pr.getMaxFlow());
+				checkFlow(G, pr, s, t);
+
+				PushRelabel directed(D, s, t, parallel);
+				directed.run();
+				EXPECT_EQ(ek.getMaxFlow(), directed.getMaxFlow());
+				checkFlow(D, directed, s, t);
+			}
+
+			reused.setTerminals(s, t);
+			reused.run();
+			EXPECT_EQ(ek.getMaxFlow(), reused.getMaxFlow());
+			checkFlow(G, reused, s, t);
+		}
+	}
+}
+
+} /* namespace NetworKit */
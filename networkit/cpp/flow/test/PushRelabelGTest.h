@@ -0,0 +1,22 @@
+/*
+ * PushRelabelGTest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef PUSHRELABELGTEST_H_
+#define PUSHRELABELGTEST_H_
+
+#include "gtest/gtest.h"
+#include "../PushRelabel.h"
+#include "../../graph/Graph.h"
+
+namespace NetworKit {
+
+class PushRelabelGTest : public testing::Test {
+};
+
+} /* namespace NetworKit */
+
+#endif /* PUSHRELABELGTEST_H_ */
@@ -9,6 +9,7 @@
 
 #include "ClusteringCoefficient.h"
 #include "../centrality/LocalClusteringCoefficient.h"
+#include "TriangleCounting.h"
 #include "../auxiliary/Random.h"
 #include "../auxiliary/Log.h"
 #include <omp.h>
@@ -166,47 +167,14 @@ double ClusteringCoefficient::approxAvgLocal(Graph& G, const count trials) {
 
 
 double ClusteringCoefficient::exactGlobal(Graph& G) {
-	count z = G.upperNodeIdBound();
-	std::vector<count> triangles(z); // triangles including node u (every triangle is counted six times)
-
-	std::vector<std::vector<bool> > nodeMarker(omp_get_max_threads());
-	for (auto &nm : nodeMarker) {
-		nm.resize(z, false);
-	}
-
-	G.balancedParallelForNodes([&](node u){
-
-		size_t tid = omp_get_thread_num();
-		count tr = 0;
-
-		if (G.degree(u) > 1) {
-			G.forEdgesOf(u, [&](node u, node v) {
-				nodeMarker[tid][v] = true;
-			});
-
-			G.forEdgesOf(u, [&](node u, node v) {
-				G.forEdgesOf(v, [&](node v, node w) {
-					if (nodeMarker[tid][w]) {
-						tr += 1;
-					}
-				});
-			});
-
-			G.forEdgesOf(u, [&](node u, node v) {
-				nodeMarker[tid][v] = false;
-			});
-		}
-
-		triangles[u] = tr;
-	});
+	TriangleCounting counter(G);
+	counter.run();
 
   double denominator = G.parallelSumForNodes([&](node u){
 		return G.degree(u) * (G.degree(u) - 1);
 	});
 
-	double cc = G.parallelSumForNodes([&](node u){
-		return triangles[u];
-	});
+	double cc = 6.0 * counter.numberOfTriangles(); // each triangle contributes six ordered pairs of neighbors
 
 	if (denominator == 0) {
 		return 0; // no triangle exists
@@ -24,6 +24,7 @@ public:
 	 * This calculates the average local clustering coefficient of graph @a G.
 	 *
 	 * @param G The graph (may not contain self-loops).
+	 * @param turbo Ignored, kept for compatibility (see LocalClusteringCoefficient).
 	 * @note $$c(G) := \frac{1}{n} \sum_{u \in V} c(u)$$
 	 * where $c(u) := \frac{2 \cdot |E(N(u))| }{\deg(u) \cdot ( \deg(u) - 1)}$
 	 */
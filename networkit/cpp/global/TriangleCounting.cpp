@@ -0,0 +1,176 @@
+/*
+ * TriangleCounting.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: NetworKit contributors
+ */
+
+#include "TriangleCounting.h"
+
+#include <numeric>
+
+namespace NetworKit {
+
+constexpr count TriangleCounting::blockSize;
+constexpr count TriangleCounting::gallopingRatio;
+
+TriangleCounting::TriangleCounting(const Graph& G) : G(G), triangles(0) {
+	if (G.isDirected()) {
+		throw std::runtime_error("TriangleCounting is not implemented for directed graphs");
+	}
+}
+
+void TriangleCounting::run() {
+	const count z = G.upperNodeIdBound();
+	const bool withEdgeIds = G.hasEdgeIds();
+
+	// rank the nodes by degree (ties broken by id) with a counting sort
+	count maxDegree = 0;
+	G.forNodes([&](node u) {
+		maxDegree = std::max(maxDegree, G.degree(u));
+	});
+	std::vector<index> bucketBegin(maxDegree + 2, 0);
+	G.forNodes([&](node u) {
+		++bucketBegin[G.degree(u) + 1];
+	});
+	std::partial_sum(bucketBegin.begin(), bucketBegin.end(), bucketBegin.begin());
+
+	const count n = G.numberOfNodes();
+	std::vector<node> nodeOfRank(n);
+	std::vector<index> rank(z, none);
+	G.forNodes([&](node u) {
+		index r = bucketBegin[G.degree(u)]++;
+		nodeOfRank[r] = u;
+		rank[u] = r;
+	});
+
+	// orient each edge towards the endpoint of higher rank
+	outBegin.assign(n + 1, 0);
+	G.parallelForNodes([&](node u) {
+		count outDegree = 0;
+		G.forNeighborsOf(u, [&](node v) {
+			outDegree += (rank[v] > rank[u]);
+		});
+		outBegin[rank[u] + 1] = outDegree;
+	});
+	std::partial_sum(outBegin.begin(), outBegin.end(), outBegin.begin());
+
+	outRank.resize(outBegin[n]);
+	outEdgeId.resize(withEdgeIds ? outBegin[n] : 0);
+#pragma omp parallel for schedule(guided)
+	for (index r = 0; r < n; ++r) {
+		const node u = nodeOfRank[r];
+		std::vector<std::pair<node, edgeid>> out;
+		out.reserve(outBegin[r + 1] - outBegin[r]);
+		G.forNeighborsOf(u, [&](node, node v, edgeid eid) {
+			if (rank[v] > r) {
+				out.emplace_back(rank[v], eid);
+			}
+		});
+		std::sort(out.begin(), out.end());
+
+		for (index k = 0; k < out.size(); ++k) {
+			outRank[outBegin[r] + k] = out[k].first;
+			if (withEdgeIds) {
+				outEdgeId[outBegin[r] + k] = out[k].second;
+			}
+		}
+	}
+
+	// each triangle r < s < t is found at the out-edge (r, s) as the common out-neighbor t of r and s
+	edgeCount.assign(outBegin[n], 0);
+	count total = 0;
+#pragma omp parallel for schedule(dynamic, 64) reduction(+:total)
+	for (index r = 0; r < n; ++r) {
+		for (index pos = outBegin[r]; pos < outBegin[r + 1]; ++pos) {
+			const node s = outRank[pos];
+			count found = 0;
+			intersect(outRank.data() + pos + 1, outBegin[r + 1] - pos - 1, outRank.data() + outBegin[s], outBegin[s + 1] - outBegin[s], [&](index i, index j) {
+				++found;
+#pragma omp atomic
+				++edgeCount[pos + 1 + i];
+#pragma omp atomic
+				++edgeCount[outBegin[s] + j];
+			});
+
+			if (found > 0) {
+#pragma omp atomic
+				edgeCount[pos] += found;
+				total += found;
+			}
+		}
+	}
+	triangles = total;
+
+	// each triangle of a node lies on two of its edges
+	nodeCount.assign(z, 0);
+#pragma omp parallel for schedule(guided)
+	for (index r = 0; r < n; ++r) {
+		count sum = 0;
+		for (index pos = outBegin[r]; pos < outBegin[r + 1]; ++pos) {
+			sum += edgeCount[pos];
+			if (edgeCount[pos] > 0) {
+#pragma omp atomic
+				nodeCount[nodeOfRank[outRank[pos]]] += edgeCount[pos];
+			}
+		}
+#pragma omp atomic
+		nodeCount[nodeOfRank[r]] += sum;
+	}
+	G.parallelForNodes([&](node u) {
+		nodeCount[u] /= 2;
+	});
+
+	hasRun = true;
+}
+
+count TriangleCounting::numberOfTriangles() const {
+	if (!hasRun) {
+		throw std::runtime_error("Call run method first");
+	}
+
+	return triangles;
+}
+
+count TriangleCounting::nodeTriangles(node u) const {
+	if (!hasRun) {
+		throw std::runtime_error("Call run method first");
+	}
+
+	return nodeCount[u];
+}
+
+std::vector<count> TriangleCounting::nodeTriangles() const {
+	if (!hasRun) {
+		throw std::runtime_error("Call run method first");
+	}
+
+	return nodeCount;
+}
+
+std::vector<count> TriangleCounting::edgeTriangles() const {
+	if (!hasRun) {
+		throw std::runtime_error("Call run method first");
+	}
+	if (outEdgeId.size() != edgeCount.size()) {
+		throw std::runtime_error("edges have not been indexed - call indexEdges first");
+	}
+
+	std::vector<count> result(G.upperEdgeIdBound(), 0);
+#pragma omp parallel for
+	for (index pos = 0; pos < edgeCount.size(); ++pos) {
+		result[outEdgeId[pos]] = edgeCount[pos];
+	}
+
+	return result;
+}
+
+std::string TriangleCounting::toString() const {
+	return "TriangleCounting";
+}
+
+bool TriangleCounting::isParallel() const {
+	return true;
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,162 @@
+/*
+ * TriangleCounting.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef TRIANGLECOUNTING_H_
+#define TRIANGLECOUNTING_H_
+
+#include "../graph/Graph.h"
+#include "../base/Algorithm.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace NetworKit {
+
+/**
+ * @ingroup global
+ * Counts the triangles of an undirected graph per node, per edge and in total.
+ *
+ * Each edge is oriented from the endpoint of lower degree to the one of higher degree (ties broken by id) and the
+ * out-neighbors of each node are stored as a sorted CSR array of ranks. A triangle u < v < w is then found exactly
+ * once, by intersecting the out-lists of u and v, and no node has more than O(sqrt(m)) out-neighbors. Lists of
+ * similar length are intersected by a blocked merge that compares blocks of @ref blockSize elements all-to-all in a
+ * vectorizable loop, lists of very different length by galloping through the longer one. The algorithm is parallel
+ * without locks and needs O(m) additional memory.
+ *
+ * Self-loops are ignored; the graph must not contain multi-edges.
+ */
+class TriangleCounting : public Algorithm {
+public:
+	/** number of elements of each list compared at once by the blocked merge */
+	static constexpr count blockSize = 8;
+
+	/** length ratio from which on the longer list is galloped through instead of merged */
+	static constexpr count gallopingRatio = 32;
+
+	/**
+	 * Constructs the TriangleCounting class for the undirected Graph @a G.
+	 *
+	 * @param G The graph.
+	 */
+	TriangleCounting(const Graph& G);
+
+	/**
+	 * Counts the triangles.
+	 */
+	void run() override;
+
+	/**
+	 * @return The number of triangles in the graph.
+	 */
+	count numberOfTriangles() const;
+
+	/**
+	 * @return The number of triangles node @a u is part of.
+	 */
+	count nodeTriangles(node u) const;
+
+	/**
+	 * @return The number of triangles each node is part of, indexed by node id.
+	 */
+	std::vector<count> nodeTriangles() const;
+
+	/**
+	 * @return The number of triangles each edge is part of, indexed by edge id. The graph needs edge ids.
+	 */
+	std::vector<count> edgeTriangles() const;
+
+	/**
+	 * Calls @a onMatch(i, j) for each pair of positions with @a a[i] == @a b[j]. Both ranges must be sorted
+	 * increasingly and must not contain duplicates.
+	 */
+	template<typename L>
+	static void intersect(const node* a, count na, const node* b, count nb, L onMatch);
+
+	std::string toString() const override;
+
+	bool isParallel() const override;
+
+protected:
+	const Graph& G;
+	count triangles;
+	std::vector<count> nodeCount; // indexed by node id
+	std::vector<index> outBegin; // indexed by rank
+	std::vector<node> outRank; // out-neighbors of each rank as ranks, sorted
+	std::vector<edgeid> outEdgeId; // edge id of each out-edge if the graph has edge ids
+	std::vector<count> edgeCount; // number of triangles of each out-edge
+};
+
+template<typename L>
+void TriangleCounting::intersect(const node* a, count na, const node* b, count nb, L onMatch) {
+	if (na * gallopingRatio < nb || nb * gallopingRatio < na) {
+		// gallop through the longer list for each element of the shorter one
+		const bool swapped = na > nb;
+		if (swapped) {
+			std::swap(a, b);
+			std::swap(na, nb);
+		}
+
+		index j = 0;
+		for (index i = 0; i < na && j < nb; ++i) {
+			index step = 1;
+			index hi = j;
+			while (hi < nb && b[hi] < a[i]) {
+				j = hi + 1;
+				hi += step;
+				step *= 2;
+			}
+			j = std::lower_bound(b + j, b + std::min(hi + 1, nb), a[i]) - b;
+			if (j < nb && b[j] == a[i]) {
+				if (swapped) {
+					onMatch(j, i);
+				} else {
+					onMatch(i, j);
+				}
+				++j;
+			}
+		}
+		return;
+	}
+
+	// blocked merge: an element of a block that does not reach the end of the other block cannot have a match later on
+	index i = 0, j = 0;
+	while (i + blockSize <= na && j + blockSize <= nb) {
+		for (index p = 0; p < blockSize; ++p) {
+			const node x = a[i + p];
+			unsigned mask = 0;
+#pragma omp simd reduction(|:mask)
+			for (index q = 0; q < blockSize; ++q) {
+				mask |= (unsigned) (x == b[j + q]) << q;
+			}
+			if (mask) {
+				onMatch(i + p, j + __builtin_ctz(mask));
+			}
+		}
+
+		const node lastA = a[i + blockSize - 1];
+		const node lastB = b[j + blockSize - 1];
+		i += (lastA <= lastB) ? blockSize : 0;
+		j += (lastB <= lastA) ? blockSize : 0;
+	}
+
+	// positions of b before j are never compared again, so no match is reported twice
+	while (i < na && j < nb) {
+		if (a[i] < b[j]) {
+			++i;
+		} else if (b[j] < a[i]) {
+			++j;
+		} else {
+			onMatch(i, j);
+			++i;
+			++j;
+		}
+	}
+}
+
+} /* namespace NetworKit */
+
+#endif /* TRIANGLECOUNTING_H_ */
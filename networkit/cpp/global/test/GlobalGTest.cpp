@@ -10,8 +10,11 @@
 #include "GlobalGTest.h"
 
 #include "../ClusteringCoefficient.h"
+#include "../TriangleCounting.h"
 
 #include "../../generators/ErdosRenyiGenerator.h"
+#include "../../generators/BarabasiAlbertGenerator.h"
+#include "../../auxiliary/Random.h"
 
 namespace NetworKit {
 
@@ -51,6 +54,63 @@ TEST_F(GlobalGTest, testGlobalClusteringCoefficient) {
 	EXPECT_NEAR(ccg, 18.0 / 34.0, 1e-9);
 }
 
+TEST_F(GlobalGTest, testTriangleCountingIntersect) {
+	for (count na : {0, 3, 8, 17, 100}) {
+		for (count nb : {0, 5, 8, 64, 4000}) {
+			std::vector<node> a, b;
+			for (node x = 0; x < 8000; ++x) {
+				if (a.size() < na && Aux::Random::probability() < 0.1) a.push_back(x);
+				if (b.size() < nb && Aux::Random::probability() < 0.5) b.push_back(x);
+			}
+
+			std::vector<node> expected;
+			std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+
+			std::vector<node> found;
+			TriangleCounting::intersect(a.data(), a.size(), b.data(), b.size(), [&](index i, index j) {
+				EXPECT_EQ(a[i], b[j]);
+				found.push_back(a[i]);
+			});
+			std::sort(found.begin(), found.end());
+			EXPECT_EQ(expected, found);
+		}
+	}
+}
+
+TEST_F(GlobalGTest, testTriangleCounting) {
+	for (Graph G : {ErdosRenyiGenerator(300, 0.1).generate(), BarabasiAlbertGenerator(20, 2000, 20).generate()}) {
+		G.indexEdges();
+		TriangleCounting counter(G);
+		counter.run();
+		std::vector<count> edgeTriangles = counter.edgeTriangles();
+
+		count total = 0;
+		G.forNodes([&](node u) {
+			count nodeTriangles = 0;
+			G.forNeighborsOf(u, [&](node v) {
+				G.forNeighborsOf(v, [&](node w) {
+					if (G.hasEdge(u, w)) {
+						++nodeTriangles;
+					}
+				});
+			});
+			EXPECT_EQ(nodeTriangles / 2, counter.nodeTriangles(u));
+			total += nodeTriangles;
+		});
+		EXPECT_EQ(total / 6, counter.numberOfTriangles());
+
+		G.forEdges([&](node u, node v, edgeid eid) {
+			count edgeTriangleCount = 0;
+			G.forNeighborsOf(u, [&](node w) {
+				if (w != v && G.hasEdge(v, w)) {
+					++edgeTriangleCount;
+				}
+			});
+			EXPECT_EQ(edgeTriangleCount, edgeTriangles[eid]);
+		});
+	}
+}
+
 
 
 
@@ -9,6 +9,7 @@
 #include "../auxiliary/Log.h"
 #include "Dijkstra.h"
 #include "BFS.h"
+#include "MultiSourceBFS.h"
 
 namespace NetworKit {
 
@@ -24,11 +25,27 @@ void APSP::run() {
 			distances[u] = dijk.getDistances();
 		});
 	} else {
-		G.parallelForNodes([&](node u){
-			BFS bfs(G, u);
-			bfs.run();
-			distances[u] = bfs.getDistances();
-		});
+		// one bit-parallel BFS per batch of 64 sources
+		std::vector<node> nodes = G.nodes();
+		const count batchSize = MultiSourceBFS::maxSources;
+		const count numberOfBatches = (nodes.size() + batchSize - 1) / batchSize;
+		#pragma omp parallel
+		{
+			MultiSourceBFS msbfs(G);
+			#pragma omp for schedule(dynamic, 1)
+			for (index batch = 0; batch < numberOfBatches; ++batch) {
+				auto first = nodes.begin() + batch * batchSize;
+				std::vector<node> sources(first, nodes.begin() + std::min((batch + 1) * batchSize, (count) nodes.size()));
+				for (node s : sources) {
+					distances[s].assign(G.upperNodeIdBound(), std::numeric_limits<edgeweight>::max());
+				}
+				msbfs.run(sources, [&](node v, count dist, uint64_t newSources) {
+					MultiSourceBFS::forSources(newSources, [&](index i) {
+						distances[sources[i]][v] = dist;
+					});
+				});
+			}
+		}
 	}
 	hasRun = true;
 }
@@ -0,0 +1,198 @@
+/*
+ * BoruvkaMSF.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: NetworKit contributors
+ */
+
+#include "BoruvkaMSF.h"
+#include "../structures/ConcurrentUnionFind.h"
+#include "../auxiliary/Random.h"
+#include "../auxiliary/SignalHandling.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace NetworKit {
+
+BoruvkaMSF::BoruvkaMSF(const Graph& G, bool maximum, bool randomTies) : G(G), maximum(maximum), randomTies(randomTies), seed(0), weight(0) {
+	if (G.isDirected()) {
+		throw std::runtime_error("BoruvkaMSF is not implemented for directed graphs");
+	}
+}
+
+void BoruvkaMSF::run() {
+	Aux::SignalHandler handler;
+	const count z = G.upperNodeIdBound();
+	const bool withEdgeIds = G.hasEdgeIds();
+	const bool useAttribute = !attribute.empty();
+	seed = randomTies ? Aux::Random::integer() : 0;
+
+	ConcurrentUnionFind uf(z);
+	std::vector<node> target(z, none); // other endpoint of the best edge leaving the component at each node
+	std::vector<double> targetWeight(z, 0.0);
+	std::vector<edgeid> targetId(z, none);
+	std::vector<std::atomic<node>> best(z); // node with the best outgoing edge of each component representative
+	std::vector<char> active(z, 0);
+	G.parallelForNodes([&](node u) {
+		active[u] = 1;
+	});
+
+	edges.clear();
+	edgeIds.clear();
+
+	bool merged = true;
+	while (merged) {
+		handler.assureRunning();
+
+#pragma omp parallel for
+		for (index u = 0; u < z; ++u) {
+			best[u].store(none, std::memory_order_relaxed);
+		}
+
+		// each node picks the best edge to another component and proposes it to its representative
+		G.balancedParallelForNodes([&](node u) {
+			target[u] = none;
+			if (!active[u]) {
+				return;
+			}
+
+			const index cu = uf.find(u);
+			G.forNeighborsOf(u, [&](node, node v, edgeweight ew, edgeid eid) {
+				if (uf.find(v) == cu) {
+					return;
+				}
+				const double w = useAttribute ? attribute[eid] : ew;
+				if (target[u] == none || better(u, v, w, u, target[u], targetWeight[u])) {
+					target[u] = v;
+					targetWeight[u] = w;
+					targetId[u] = eid;
+				}
+			});
+
+			// components only grow, so a node without outgoing edges stays without them
+			if (target[u] == none) {
+				active[u] = 0;
+				return;
+			}
+
+			// release/acquire so that the candidate of a published node is visible to the other threads
+			node current = best[cu].load(std::memory_order_acquire);
+			while (current == none || better(u, target[u], targetWeight[u], current, target[current], targetWeight[current])) {
+				if (best[cu].compare_exchange_weak(current, u, std::memory_order_release, std::memory_order_acquire)) {
+					break;
+				}
+			}
+		});
+
+		// the chosen edges form a forest except for edges chosen by both of their components, which merge only once
+		merged = false;
+#pragma omp parallel
+		{
+			std::vector<WeightedEdge> localEdges;
+			std::vector<edgeid> localIds;
+
+#pragma omp for schedule(guided) nowait
+			for (index c = 0; c < z; ++c) {
+				const node u = best[c].load(std::memory_order_relaxed);
+				if (u != none && uf.merge(u, target[u])) {
+					localEdges.emplace_back(std::min(u, target[u]), std::max(u, target[u]), targetWeight[u]);
+					if (withEdgeIds) {
+						localIds.push_back(targetId[u]);
+					}
+				}
+			}
+
+			if (!localEdges.empty()) {
+#pragma omp critical
+				{
+					edges.insert(edges.end(), localEdges.begin(), localEdges.end());
+					edgeIds.insert(edgeIds.end(), localIds.begin(), localIds.end());
+					merged = true;
+				}
+			}
+		}
+
+		uf.compress();
+	}
+
+	// sort by endpoints so that the output does not depend on the thread schedule
+	std::vector<index> order(edges.size());
+	for (index i = 0; i < order.size(); ++i) {
+		order[i] = i;
+	}
+	std::sort(order.begin(), order.end(), [&](index a, index b) {
+		return edges[a].u < edges[b].u || (edges[a].u == edges[b].u && edges[a].v < edges[b].v);
+	});
+
+	std::vector<WeightedEdge> sortedEdges;
+	std::vector<edgeid> sortedIds;
+	sortedEdges.reserve(edges.size());
+	sortedIds.reserve(edgeIds.size());
+	weight = 0;
+	for (index i : order) {
+		sortedEdges.push_back(edges[i]);
+		if (withEdgeIds) {
+			sortedIds.push_back(edgeIds[i]);
+		}
+		weight += edges[i].weight;
+	}
+	edges = std::move(sortedEdges);
+	edgeIds = std::move(sortedIds);
+
+	hasRun = true;
+}
+
+const std::vector<WeightedEdge>& BoruvkaMSF::forestEdges() const {
+	if (!hasRun) {
+		throw std::runtime_error("Call run method first");
+	}
+
+	return edges;
+}
+
+const std::vector<edgeid>& BoruvkaMSF::forestEdgeIds() const {
+	if (!hasRun) {
+		throw std::runtime_error("Call run method first");
+	}
+	if (!G.hasEdgeIds()) {
+		throw std::runtime_error("edges have not been indexed - call indexEdges first");
+	}
+
+	return edgeIds;
+}
+
+double BoruvkaMSF::totalWeight() const {
+	if (!hasRun) {
+		throw std::runtime_error("Call run method first");
+	}
+
+	return weight;
+}
+
+Graph BoruvkaMSF::getForest() const {
+	if (!hasRun) {
+		throw std::runtime_error("Call run method first");
+	}
+
+	Graph forest = G.copyNodes();
+	for (const WeightedEdge& e : edges) {
+		if (attribute.empty()) {
+			forest.addEdge(e.u, e.v, e.weight);
+		} else {
+			forest.addEdge(e.u, e.v);
+		}
+	}
+
+	return forest;
+}
+
+std::string BoruvkaMSF::toString() const {
+	return "BoruvkaMSF";
+}
+
+bool BoruvkaMSF::isParallel() const {
+	return true;
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,141 @@
+/*
+ * BoruvkaMSF.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef BORUVKAMSF_H_
+#define BORUVKAMSF_H_
+
+#include "Graph.h"
+#include "../base/Algorithm.h"
+
+#include <vector>
+
+namespace NetworKit {
+
+/**
+ * @ingroup graph
+ * Computes a minimum- or maximum-weight spanning forest of an undirected graph with a parallel version of Boruvka's
+ * algorithm.
+ *
+ * Edges are compared by weight, ties are broken by a key of their endpoints (optionally randomized per run), so the
+ * order is total and the forest is unique for a given key. In each round every node scans its adjacency in parallel for
+ * the best edge leaving its component, the best edge of each component is chosen by compare-and-swap on the component
+ * representative, and the chosen edges are merged into a lock-free union-find. The number of components at least halves
+ * per round, so there are at most log(n) rounds; nodes whose neighbors all lie in their own component are not scanned
+ * again. Unlike Kruskal's algorithm, no edge list is materialized or sorted.
+ */
+class BoruvkaMSF : public Algorithm {
+public:
+	/**
+	 * Initializes the spanning forest algorithm using the edge weights of @a G.
+	 *
+	 * @param G The undirected input graph.
+	 * @param maximum Compute a maximum-weight instead of a minimum-weight spanning forest.
+	 * @param randomTies Break ties between edges of equal weight by a random order drawn anew in each run.
+	 */
+	BoruvkaMSF(const Graph& G, bool maximum = false, bool randomTies = false);
+
+	/**
+	 * Initializes the spanning forest algorithm using an edge attribute as weight. The graph needs edge ids.
+	 *
+	 * This copies the attribute values, the supplied attribute vector is not stored.
+	 *
+	 * @param G The undirected input graph.
+	 * @param attribute The weight of each edge indexed by edge id, can be of any numeric type.
+	 * @param maximum Compute a maximum-weight instead of a minimum-weight spanning forest.
+	 * @param randomTies Break ties between edges of equal weight by a random order drawn anew in each run.
+	 */
+	template <typename A>
+	BoruvkaMSF(const Graph& G, const std::vector<A>& attribute, bool maximum = false, bool randomTies = false);
+
+	/**
+	 * Computes the spanning forest.
+	 */
+	void run() override;
+
+	/**
+	 * @return The edges of the spanning forest sorted by their endpoints, each with its weight (or attribute value).
+	 */
+	const std::vector<WeightedEdge>& forestEdges() const;
+
+	/**
+	 * @return The id of each edge of forestEdges(). Only available if the graph has edge ids.
+	 */
+	const std::vector<edgeid>& forestEdgeIds() const;
+
+	/**
+	 * @return The sum of the weights (or attribute values) of the forest edges.
+	 */
+	double totalWeight() const;
+
+	/**
+	 * @return The spanning forest as a graph on the nodes of @a G. If an attribute is used, the forest edges get the default weight.
+	 */
+	Graph getForest() const;
+
+	std::string toString() const override;
+
+	bool isParallel() const override;
+
+protected:
+	const Graph& G;
+	std::vector<double> attribute; // empty if edge weights are used
+	bool maximum;
+	bool randomTies;
+	uint64_t seed;
+	std::vector<WeightedEdge> edges;
+	std::vector<edgeid> edgeIds;
+	double weight;
+
+private:
+	/**
+	 * @return If edge (@a a, @a b) with weight @a wab precedes edge (@a c, @a d) with weight @a wcd.
+	 */
+	bool better(node a, node b, double wab, node c, node d, double wcd) const;
+
+	uint64_t tieKey(node u, node v) const;
+};
+
+template <typename A>
+BoruvkaMSF::BoruvkaMSF(const Graph& G, const std::vector<A>& attribute, bool maximum, bool randomTies) :
+		BoruvkaMSF(G, maximum, randomTies) {
+	if (!G.hasEdgeIds()) {
+		throw std::runtime_error("Error: Edges of G must be indexed for using edge attributes");
+	}
+
+	this->attribute.assign(attribute.begin(), attribute.end());
+}
+
+inline uint64_t BoruvkaMSF::tieKey(node u, node v) const {
+	if (!randomTies) {
+		return 0;
+	}
+
+	// splitmix64 finalizer applied to the unordered pair of endpoints
+	uint64_t x = seed ^ (std::min(u, v) * 0x9E3779B97F4A7C15ULL) ^ (std::max(u, v) + 0xBF58476D1CE4E5B9ULL);
+	x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+	return x ^ (x >> 31);
+}
+
+inline bool BoruvkaMSF::better(node a, node b, double wab, node c, node d, double wcd) const {
+	if (wab != wcd) {
+		return maximum ? wab > wcd : wab < wcd;
+	}
+
+	const uint64_t kab = tieKey(a, b);
+	const uint64_t kcd = tieKey(c, d);
+	if (kab != kcd) {
+		return kab < kcd;
+	}
+
+	const node lab = std::min(a, b), lcd = std::min(c, d);
+	return lab < lcd || (lab == lcd && std::max(a, b) < std::max(c, d));
+}
+
+} /* namespace NetworKit */
+
+#endif /* BORUVKAMSF_H_ */
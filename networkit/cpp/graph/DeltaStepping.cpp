@@ -0,0 +1,180 @@
+/*
+ * DeltaStepping.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#include <atomic>
+#include <omp.h>
+
+#include "DeltaStepping.h"
+#include "../auxiliary/Parallel.h"
+
+namespace NetworKit {
+
+DeltaStepping::DeltaStepping(const Graph& G, node source, bool storePaths, bool storeStack, node target, edgeweight delta) : SSSP(G, source, storePaths, storeStack, target), delta(delta) {
+	if (delta < 0) {
+		throw std::invalid_argument("delta must not be negative");
+	}
+}
+
+void DeltaStepping::run() {
+	const edgeweight infDist = std::numeric_limits<edgeweight>::max();
+	const count z = G.upperNodeIdBound();
+
+	if (storePaths || storeStack) {
+		// within a bucket, nodes joined by zero-weight edges have equal distances
+		// but no consistent settling order, so predecessors and the stack are undefined
+		bool zeroWeight = false;
+		G.forEdges([&](node, node, edgeweight w) {
+			zeroWeight = zeroWeight || w == 0;
+		});
+		if (zeroWeight) {
+			throw std::runtime_error("DeltaStepping: storePaths and storeStack require positive edge weights");
+		}
+	}
+
+	if (delta == 0) {
+		edgeweight maxWeight = 0;
+		G.forEdges([&](node, node, edgeweight w) {
+			maxWeight = std::max(maxWeight, w);
+		});
+		double averageDegree = G.numberOfNodes() > 0 ? (double) G.numberOfEdges() / G.numberOfNodes() : 0.0;
+		delta = averageDegree > 1.0 ? maxWeight / averageDegree : maxWeight;
+		if (delta <= 0) {
+			delta = 1.0; // all edges have weight zero or there are none
+		}
+	}
+
+	std::vector<std::atomic<edgeweight>> dist(z);
+	#pragma omp parallel for
+	for (node u = 0; u < z; ++u) {
+		dist[u].store(infDist, std::memory_order_relaxed);
+	}
+	dist[source].store(0, std::memory_order_relaxed);
+
+	auto bucketOf = [&](edgeweight d) -> index {
+		return static_cast<index>(d / delta);
+	};
+
+	std::vector<std::vector<node>> buckets(1, std::vector<node>{source});
+	std::vector<std::vector<std::pair<index, node>>> localRequests(omp_get_max_threads());
+	std::vector<uint8_t> inFrontier(z, 0);
+	std::vector<uint8_t> settled(z, 0);
+	std::vector<node> reached;
+
+	// relaxes the light (w <= delta) or heavy edges of the frontier; improved nodes are queued in their new buckets
+	auto relax = [&](const std::vector<node>& frontier, bool light) {
+		#pragma omp parallel
+		{
+			auto& requests = localRequests[omp_get_thread_num()];
+			#pragma omp for schedule(dynamic, 64)
+			for (index i = 0; i < frontier.size(); ++i) {
+				node u = frontier[i];
+				G.forEdgesOf(u, [&](node, node v, edgeweight w) {
+					if ((w <= delta) != light) {
+						return;
+					}
+					edgeweight newDist = dist[u].load(std::memory_order_relaxed) + w;
+					edgeweight current = dist[v].load(std::memory_order_relaxed);
+					while (newDist < current) {
+						if (dist[v].compare_exchange_weak(current, newDist, std::memory_order_relaxed)) {
+							requests.emplace_back(bucketOf(newDist), v);
+							break;
+						}
+					}
+				});
+			}
+		}
+		for (auto& requests : localRequests) {
+			for (auto& request : requests) {
+				if (request.first >= buckets.size()) {
+					buckets.resize(request.first + 1);
+				}
+				buckets[request.first].push_back(request.second);
+			}
+			requests.clear();
+		}
+	};
+
+	std::vector<node> frontier;
+	std::vector<node> settledInBucket;
+	for (index i = 0; i < buckets.size(); ++i) {
+		if (target != none && dist[target].load(std::memory_order_relaxed) < i * delta) {
+			break;
+		}
+		settledInBucket.clear();
+		while (!buckets[i].empty()) {
+			// drop stale and duplicate entries
+			frontier.clear();
+			for (node v : buckets[i]) {
+				if (!inFrontier[v] && bucketOf(dist[v].load(std::memory_order_relaxed)) == i) {
+					inFrontier[v] = 1;
+					frontier.push_back(v);
+					if (!settled[v]) {
+						settled[v] = 1;
+						settledInBucket.push_back(v);
+					}
+				}
+			}
+			std::vector<node>().swap(buckets[i]);
+			for (node v : frontier) {
+				inFrontier[v] = 0;
+			}
+			relax(frontier, true);
+		}
+		relax(settledInBucket, false);
+		reached.insert(reached.end(), settledInBucket.begin(), settledInBucket.end());
+	}
+
+	distances.resize(z);
+	#pragma omp parallel for
+	for (node u = 0; u < z; ++u) {
+		distances[u] = dist[u].load(std::memory_order_relaxed);
+	}
+
+	if (storePaths || storeStack) {
+		// nodes settled in the same bucket are not ordered by distance yet
+		Aux::Parallel::sort(reached.begin(), reached.end(), [&](node u, node v) {
+			return distances[u] < distances[v] || (distances[u] == distances[v] && u < v);
+		});
+	}
+	if (storePaths) {
+		computePaths(reached);
+	}
+	if (storeStack) {
+		stack = std::move(reached);
+	}
+}
+
+void DeltaStepping::computePaths(const std::vector<node>& reached) {
+	count z = G.upperNodeIdBound();
+	previous.clear();
+	previous.resize(z);
+	npaths.clear();
+	npaths.resize(z, 0);
+
+	#pragma omp parallel for schedule(dynamic, 64)
+	for (index i = 0; i < reached.size(); ++i) {
+		node v = reached[i];
+		if (v == source) {
+			continue;
+		}
+		G.forInEdgesOf(v, [&](node, node u, edgeweight w) {
+			if (distances[u] != std::numeric_limits<edgeweight>::max() && distances[u] + w == distances[v]) {
+				previous[v].push_back(u);
+			}
+		});
+	}
+
+	// predecessors come first in order of increasing distance
+	npaths[source] = 1;
+	for (node v : reached) {
+		for (node u : previous[v]) {
+			npaths[v] += npaths[u];
+		}
+	}
+}
+
+} /* namespace NetworKit */
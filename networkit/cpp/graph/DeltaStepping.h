@@ -0,0 +1,70 @@
+/*
+ * DeltaStepping.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef DELTASTEPPING_H_
+#define DELTASTEPPING_H_
+
+#include "Graph.h"
+#include "SSSP.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup graph
+ * Parallel delta-stepping SSSP algorithm (Meyer and Sanders, 2003) for graphs
+ * with non-negative edge weights.
+ *
+ * Tentative distances are kept in buckets of width delta. The nodes of the
+ * smallest non-empty bucket relax their light edges (weight <= delta) in
+ * parallel until the bucket stays empty, then the settled nodes relax their
+ * heavy edges once. Small values of delta approach Dijkstra's algorithm,
+ * large values approach Bellman-Ford. The distances are the same as those of
+ * Dijkstra; predecessors and path counts are derived from them afterwards.
+ * Zero edge weights are only supported for distances: with @a storePaths or
+ * @a storeStack, run() throws if the graph contains an edge of weight zero.
+ */
+class DeltaStepping : public SSSP {
+
+public:
+
+	/**
+	 * Creates the DeltaStepping class for @a G and the source node @a source.
+	 *
+	 * @param G The graph.
+	 * @param source The source node.
+	 * @param storePaths	store paths and number of paths? (requires positive edge weights)
+	 * @param storeStack	maintain a stack of nodes in decreasing order of distance (requires positive edge weights)
+	 * @param target	stop once the bucket containing @a target has been settled
+	 * @param delta	bucket width; 0 chooses the maximum edge weight divided by the average degree
+	 */
+	DeltaStepping(const Graph& G, node source, bool storePaths=true, bool storeStack=false, node target = none, edgeweight delta = 0);
+
+	/**
+	 * Performs the delta-stepping SSSP algorithm on the graph given in the constructor.
+	 */
+	virtual void run();
+
+	/**
+	 * @return The bucket width used by the last run.
+	 */
+	edgeweight getDelta() const;
+
+private:
+	edgeweight delta;
+
+	/**
+	 * Computes predecessors and path counts from the final distances.
+	 */
+	void computePaths(const std::vector<node>& reached);
+};
+
+inline edgeweight DeltaStepping::getDelta() const {
+	return delta;
+}
+
+} /* namespace NetworKit */
+#endif /* DELTASTEPPING_H_ */
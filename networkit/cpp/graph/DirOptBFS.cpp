@@ -0,0 +1,176 @@
+/*
+ * DirOptBFS.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#include <atomic>
+#include <omp.h>
+
+#include "DirOptBFS.h"
+
+namespace NetworKit {
+
+constexpr double DirOptBFS::alpha;
+constexpr double DirOptBFS::beta;
+
+DirOptBFS::DirOptBFS(const Graph& G, node source, bool storePaths, bool storeStack, node target) : SSSP(G, source, storePaths, storeStack, target) {
+}
+
+void DirOptBFS::run() {
+	const edgeweight infDist = std::numeric_limits<edgeweight>::max();
+	const count z = G.upperNodeIdBound();
+	distances.clear();
+	distances.resize(z, infDist);
+
+	// one bit per node; value-initialization zeroes the words
+	const count words = (z + 63) / 64;
+	std::vector<std::atomic<uint64_t>> visited(words);
+	std::vector<std::atomic<uint64_t>> inFrontier(words);
+	auto testBit = [](const std::vector<std::atomic<uint64_t>>& bits, node v) {
+		return (bits[v / 64].load(std::memory_order_relaxed) >> (v % 64)) & 1;
+	};
+	// returns true if the bit of v was not set before
+	auto setBit = [](std::vector<std::atomic<uint64_t>>& bits, node v) {
+		uint64_t mask = uint64_t(1) << (v % 64);
+		return !(bits[v / 64].fetch_or(mask, std::memory_order_relaxed) & mask);
+	};
+
+	// nodes in the order of their levels; levelBegin[i] is the first node of level i
+	std::vector<node> order;
+	std::vector<index> levelBegin;
+	std::vector<node> frontier = {source};
+	std::vector<std::vector<node>> localNext(omp_get_max_threads());
+
+	setBit(visited, source);
+	distances[source] = 0;
+	levelBegin.push_back(0);
+	order.push_back(source);
+
+	const std::vector<std::vector<node>>& inAdjacency = G.isDirected() ? G.inEdges : G.outEdges;
+	count unexploredEdges = 0;
+	#pragma omp parallel for reduction(+:unexploredEdges)
+	for (node u = 0; u < z; ++u) {
+		unexploredEdges += G.degreeIn(u);
+	}
+	unexploredEdges -= G.degreeIn(source);
+	bool bottomUp = false;
+	count level = 0;
+
+	while (!frontier.empty()) {
+		if (target != none && testBit(visited, target)) {
+			break;
+		}
+
+		count frontierEdges = 0;
+		#pragma omp parallel for reduction(+:frontierEdges)
+		for (index i = 0; i < frontier.size(); ++i) {
+			frontierEdges += G.degreeOut(frontier[i]);
+		}
+		if (bottomUp) {
+			bottomUp = frontier.size() * beta >= G.numberOfNodes();
+		} else {
+			bottomUp = frontierEdges * alpha > unexploredEdges;
+		}
+
+		const edgeweight nextDist = level + 1;
+		if (bottomUp) {
+			#pragma omp parallel for
+			for (index w = 0; w < words; ++w) {
+				inFrontier[w].store(0, std::memory_order_relaxed);
+			}
+			#pragma omp parallel for
+			for (index i = 0; i < frontier.size(); ++i) {
+				setBit(inFrontier, frontier[i]);
+			}
+
+			// every unvisited node looks for a parent in the frontier and stops at the first one
+			#pragma omp parallel
+			{
+				std::vector<node>& next = localNext[omp_get_thread_num()];
+				#pragma omp for schedule(dynamic, 1024)
+				for (node v = 0; v < z; ++v) {
+					if (testBit(visited, v) || !G.hasNode(v)) {
+						continue;
+					}
+					for (node u : inAdjacency[v]) {
+						if (u != none && testBit(inFrontier, u)) {
+							setBit(visited, v);
+							distances[v] = nextDist;
+							next.push_back(v);
+							break;
+						}
+					}
+				}
+			}
+		} else {
+			// the frontier claims its unvisited out-neighbors
+			#pragma omp parallel
+			{
+				std::vector<node>& next = localNext[omp_get_thread_num()];
+				#pragma omp for schedule(dynamic, 64)
+				for (index i = 0; i < frontier.size(); ++i) {
+					for (node v : G.outEdges[frontier[i]]) {
+						if (v != none && !testBit(visited, v) && setBit(visited, v)) {
+							distances[v] = nextDist;
+							next.push_back(v);
+						}
+					}
+				}
+			}
+		}
+
+		frontier.clear();
+		for (auto& next : localNext) {
+			frontier.insert(frontier.end(), next.begin(), next.end());
+			next.clear();
+		}
+		count discoveredEdges = 0;
+		#pragma omp parallel for reduction(+:discoveredEdges)
+		for (index i = 0; i < frontier.size(); ++i) {
+			discoveredEdges += G.degreeIn(frontier[i]);
+		}
+		unexploredEdges -= discoveredEdges;
+
+		if (!frontier.empty()) {
+			levelBegin.push_back(order.size());
+			order.insert(order.end(), frontier.begin(), frontier.end());
+		}
+		++level;
+	}
+	levelBegin.push_back(order.size());
+
+	if (storePaths) {
+		computePaths(order, levelBegin);
+	}
+
+	if (storeStack) {
+		stack = std::move(order);
+	}
+}
+
+void DirOptBFS::computePaths(const std::vector<node>& order, const std::vector<index>& levelBegin) {
+	count z = G.upperNodeIdBound();
+	previous.clear();
+	previous.resize(z);
+	npaths.clear();
+	npaths.resize(z, 0);
+	npaths[source] = 1;
+
+	// a level only depends on the previous one, so its nodes are independent of each other
+	for (index level = 1; level + 1 < levelBegin.size(); ++level) {
+		#pragma omp parallel for schedule(dynamic, 64)
+		for (index i = levelBegin[level]; i < levelBegin[level + 1]; ++i) {
+			node v = order[i];
+			G.forInNeighborsOf(v, [&](node u) {
+				if (distances[u] + 1 == distances[v]) {
+					previous[v].push_back(u);
+					npaths[v] += npaths[u];
+				}
+			});
+		}
+	}
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,60 @@
+/*
+ * DirOptBFS.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef DIROPTBFS_H_
+#define DIROPTBFS_H_
+
+#include "Graph.h"
+#include "SSSP.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup graph
+ * Parallel level-synchronous breadth-first search that switches between
+ * top-down and bottom-up steps depending on the size of the frontier
+ * (direction-optimizing BFS, Beamer et al., SC 2012).
+ *
+ * Top-down steps expand the frontier in parallel and claim unvisited
+ * neighbors in a visited bitmap. Once the frontier touches more than
+ * 1/alpha of the edges incident to unvisited nodes, the search switches to
+ * bottom-up steps in which every unvisited node scans its in-neighbors for
+ * a frontier member and stops at the first hit; it switches back when the
+ * frontier shrinks below n/beta nodes. Distances equal those of BFS; within
+ * a level, the order of the stack depends on the thread schedule.
+ */
+class DirOptBFS : public SSSP {
+
+public:
+	/**
+	 * Constructs the direction-optimizing BFS for @a G and source node @a source.
+	 *
+	 * @param G The graph.
+	 * @param source The source node of the breadth-first search.
+	 * @param storePaths	store paths and number of paths?
+	 * @param storeStack	maintain a stack of nodes in decreasing order of distance
+	 * @param target	stop after the level containing @a target has been reached
+	 */
+	DirOptBFS(const Graph& G, node source, bool storePaths=true, bool storeStack=false, node target = none);
+
+	/**
+	 * Breadth-first search from @a source.
+	 */
+	virtual void run();
+
+private:
+	static constexpr double alpha = 14.0;
+	static constexpr double beta = 24.0;
+
+	/**
+	 * Computes predecessors and path counts level by level from the final distances.
+	 */
+	void computePaths(const std::vector<node>& order, const std::vector<index>& levelBegin);
+};
+
+} /* namespace NetworKit */
+#endif /* DIROPTBFS_H_ */
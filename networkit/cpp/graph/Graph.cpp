@@ -26,6 +26,7 @@ Graph::Graph(count n, bool weighted, bool directed) :
 	weighted(weighted), // indicates whether the graph is weighted or not
 	directed(directed), // indicates whether the graph is directed or not
 	edgesIndexed(false), // edges are not indexed by default
+	edgesSorted(false), // set by sortEdges
 
 	exists(n, true),
 
@@ -80,6 +81,7 @@ Graph::Graph(const Graph& G, bool weighted, bool directed) :
 	weighted(weighted),
 	directed(directed),
 	edgesIndexed(false), //edges are not indexed by default
+	edgesSorted(G.edgesSorted), // only lost when merging in and out edges below
 	exists(G.exists),
 
 	// let the following be empty for the start, we fill them later
@@ -126,6 +128,7 @@ Graph::Graph(const Graph& G, bool weighted, bool directed) :
 	} else if (G.isDirected()) {
 		// G is directed, but we want an undirected graph
 		// so we need to combine the out and in stuff for every node
+		edgesSorted = false;
 		outDeg.resize(z);
 		outEdges.resize(z);
 		for (node u = 0; u < z; u++) {
@@ -191,6 +194,10 @@ index Graph::indexInInEdgeArray(node v, node u) const {
 	if (!directed) {
 		return indexInOutEdgeArray(v, u);
 	}
+	if (edgesSorted) {
+		auto it = std::lower_bound(inEdges[v].begin(), inEdges[v].end(), u);
+		return (it != inEdges[v].end() && *it == u) ? it - inEdges[v].begin() : none;
+	}
 	for (index i = 0; i < inEdges[v].size(); i++) {
 		node x = inEdges[v][i];
 		if (x == u) {
@@ -201,6 +208,10 @@ index Graph::indexInInEdgeArray(node v, node u) const {
 }
 
 index Graph::indexInOutEdgeArray(node u, node v) const {
+	if (edgesSorted) {
+		auto it = std::lower_bound(outEdges[u].begin(), outEdges[u].end(), v);
+		return (it != outEdges[u].end() && *it == v) ? it - outEdges[u].begin() : none;
+	}
 	for (index i = 0; i < outEdges[u].size(); i++) {
 		node x = outEdges[u][i];
 		if (x == v) {
@@ -324,6 +335,7 @@ void Graph::shrinkToFit() {
 }
 
 void Graph::compactEdges() {
+	edgesSorted = false; // the last entries are moved into the gaps
 	this->parallelForNodes([&](node u) {
 		if (degreeOut(u) != outEdges[u].size()) {
 			if (degreeOut(u) == 0) {
@@ -447,6 +459,8 @@ void Graph::sortEdges() {
 		inEdgeWeights.swap(targetWeight);
 		inEdgeIds.swap(targetEdgeIds);
 	}
+
+	edgesSorted = true;
 }
 
 
@@ -495,6 +509,13 @@ node Graph::addNode() {
 		inEdges.push_back(std::vector<node>{});
 	}
 
+	if (edgesIndexed) {
+		outEdgeIds.push_back(std::vector<edgeid>{});
+		if (directed) {
+			inEdgeIds.push_back(std::vector<edgeid>{});
+		}
+	}
+
 
 	return v;
 }
@@ -599,6 +620,13 @@ void Graph::addEdge(node u, node v, edgeweight ew) {
 	assert (v < z);
 	assert (exists[v]);
 
+	// appending keeps the adjacency arrays sorted only if the new neighbor has the largest id
+	if (edgesSorted) {
+		edgesSorted = (outEdges[u].empty() || outEdges[u].back() <= v)
+			&& (directed ? (inEdges[v].empty() || inEdges[v].back() <= u)
+			             : (u == v || outEdges[v].empty() || outEdges[v].back() <= u));
+	}
+
 	m++; // increase number of edges
 	outDeg[u]++;
 	outEdges[u].push_back(v);
@@ -690,6 +718,9 @@ void Graph::removeEdge(node u, node v) {
 		assert(storedNumberOfSelfLoops >= 0);
 	}
 
+	// deleted entries are marked with none, which breaks the binary search
+	edgesSorted = false;
+
 	// dose not make a lot of sense do remove attributes,
 	// cause the edge is marked as deleted and we have no null values for the attributes
 }
@@ -714,6 +745,7 @@ void Graph::swapEdge(node s1, node t1, node s2, node t2) {
 	index t2s2 = indexInInEdgeArray(t2, s2);
 
 	std::swap(outEdges[s1][s1t1], outEdges[s2][s2t2]);
+	edgesSorted = false;
 
 	if (directed) {
 		std::swap(inEdges[t1][t1s1], inEdges[t2][t2s2]);
@@ -80,6 +80,7 @@ class Graph final {
 
 	friend class ParallelPartitionCoarsening;
 	friend class GraphBuilder;
+	friend class DirOptBFS;
 
 private:
 	// graph attributes
@@ -97,6 +98,7 @@ private:
 	bool weighted; //!< true if the graph is weighted, false otherwise
 	bool directed; //!< true if the graph is directed, false otherwise
 	bool edgesIndexed; //!< true if edge ids have been assigned
+	bool edgesSorted; //!< true if all adjacency arrays are sorted by node id, edge lookups then use binary search
 
 	// per node data
 	std::vector<bool> exists; //!< exists[v] is true if node v has not been removed from the graph
@@ -125,7 +127,8 @@ private:
 	index indexInInEdgeArray(node v, node u) const;
 
 	/**
-	 * Returns the index of node v in the array of outgoing edges of node u.
+	 * Returns the index of node v in the array of outgoing edges of node u. Takes O(log deg(u)) time
+	 * if the adjacency arrays are sorted (see sortEdges()), O(deg(u)) time otherwise.
 	 */
 	index indexInOutEdgeArray(node u, node v) const;
 
@@ -452,10 +455,18 @@ public:
 
 	/**
 	 * Sorts the adjacency arrays by node id. While the running time is linear this
-	 * temporarily duplicates the memory.
+	 * temporarily duplicates the memory. Afterwards edgeId(), hasEdge(), weight() and the
+	 * other lookups of single edges use binary search until an edge is removed, swapped or
+	 * added out of order.
 	 */
 	void sortEdges();
 
+	/**
+	 * Checks if the adjacency arrays are sorted by node id, i.e. if lookups of single edges
+	 * take logarithmic instead of linear time in the degree.
+	 */
+	bool hasSortedEdges() const { return edgesSorted; }
+
 	/**
 	 * Set name of graph to @a name.
 	 * @param name The name.
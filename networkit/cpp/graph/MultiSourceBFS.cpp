@@ -0,0 +1,17 @@
+/*
+ * MultiSourceBFS.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#include "MultiSourceBFS.h"
+
+namespace NetworKit {
+
+constexpr count MultiSourceBFS::maxSources;
+
+MultiSourceBFS::MultiSourceBFS(const Graph& G) : G(G) {
+}
+
+} /* namespace NetworKit */
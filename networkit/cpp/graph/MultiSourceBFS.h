@@ -0,0 +1,116 @@
+/*
+ * MultiSourceBFS.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef MULTISOURCEBFS_H_
+#define MULTISOURCEBFS_H_
+
+#include <stdexcept>
+
+#include "Graph.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup graph
+ * Bit-parallel breadth-first search from up to 64 sources at once (MS-BFS,
+ * Then et al., VLDB 2015).
+ *
+ * Every node holds one bit per source in three 64-bit words: the sources
+ * that have already reached it, the sources whose frontier contains it in
+ * the current level and those that reach it in the next level. A level
+ * streams the adjacency of the active nodes once for the whole batch, so
+ * sources whose searches overlap share the work.
+ *
+ * An instance keeps its bitsets between runs and is not thread-safe;
+ * callers that process several batches in parallel use one instance per thread.
+ */
+class MultiSourceBFS {
+
+public:
+	/** Maximum number of sources of one run. */
+	static constexpr count maxSources = 64;
+
+	/**
+	 * @param G The graph. For directed graphs the searches follow out-edges.
+	 */
+	MultiSourceBFS(const Graph& G);
+
+	/**
+	 * Runs a BFS from each of the given @a sources (at most 64). For every node
+	 * @a v and every distance @a dist at which @a v is reached by at least one
+	 * source, @a handle(v, dist, newSources) is called once, where bit i of
+	 * @a newSources is set iff @a v has distance @a dist from sources[i].
+	 * Calls are made in order of nondecreasing distance.
+	 */
+	template<typename L>
+	void run(const std::vector<node>& sources, L handle);
+
+	/**
+	 * Calls @a handle(i) for every set bit i of @a sourceSet, i.e. for the index of
+	 * every source contained in a set passed to the handle of run().
+	 */
+	template<typename L>
+	static void forSources(uint64_t sourceSet, L handle);
+
+private:
+	const Graph& G;
+	std::vector<uint64_t> seen;
+	std::vector<uint64_t> visit;
+	std::vector<uint64_t> visitNext;
+};
+
+template<typename L>
+void MultiSourceBFS::run(const std::vector<node>& sources, L handle) {
+	if (sources.size() > maxSources) {
+		throw std::invalid_argument("MultiSourceBFS supports at most 64 sources per run");
+	}
+	const count z = G.upperNodeIdBound();
+	seen.assign(z, 0);
+	visit.assign(z, 0);
+	visitNext.assign(z, 0);
+
+	for (index i = 0; i < sources.size(); ++i) {
+		uint64_t bit = uint64_t(1) << i;
+		seen[sources[i]] |= bit;
+		visit[sources[i]] |= bit;
+		handle(sources[i], (count) 0, bit);
+	}
+
+	bool active = !sources.empty();
+	for (count dist = 1; active; ++dist) {
+		active = false;
+		for (node u = 0; u < z; ++u) {
+			uint64_t frontier = visit[u];
+			if (frontier != 0) {
+				G.forNeighborsOf(u, [&](node v) {
+					visitNext[v] |= frontier;
+				});
+			}
+		}
+		for (node v = 0; v < z; ++v) {
+			uint64_t newSources = visitNext[v] & ~seen[v];
+			visitNext[v] = 0;
+			visit[v] = newSources;
+			if (newSources != 0) {
+				seen[v] |= newSources;
+				handle(v, dist, newSources);
+				active = true;
+			}
+		}
+	}
+}
+
+template<typename L>
+void MultiSourceBFS::forSources(uint64_t sourceSet, L handle) {
+	while (sourceSet != 0) {
+		handle((index) __builtin_ctzll(sourceSet));
+		sourceSet &= sourceSet - 1;
+	}
+}
+
+} /* namespace NetworKit */
+#endif /* MULTISOURCEBFS_H_ */
@@ -4,11 +4,10 @@
 
 #include "RandomMaximumSpanningForest.h"
 #include "../auxiliary/SignalHandling.h"
-#include "../auxiliary/Parallel.h"
 
 namespace NetworKit {
 
-RandomMaximumSpanningForest::RandomMaximumSpanningForest(const Graph &G) : G(G), hasWeightedEdges(false), hasMSF(false), hasAttribute(false) { };
+RandomMaximumSpanningForest::RandomMaximumSpanningForest(const Graph &G) : G(G), boruvka(G, true, true), hasMSF(false), hasAttribute(false) { };
 
 void RandomMaximumSpanningForest::run() {
 	hasRun = false;
@@ -17,53 +16,21 @@ void RandomMaximumSpanningForest::run() {
 
 	Aux::SignalHandler handler;
 
-	msf = G.copyNodes();
+	boruvka.run();
 
 	handler.assureRunning();
 
-	bool useEdgeWeights = false;
-
-	if (!hasWeightedEdges) {
-		weightedEdges.reserve(G.numberOfEdges());
-
-		G.forEdges([&](node u, node v, edgeweight weight, edgeid eid) {
-			weightedEdges.emplace_back(u, v, weight, eid);
-		});
-
-		hasWeightedEdges = true;
-		useEdgeWeights = true;
-	}
-
-	handler.assureRunning();
+	msf = boruvka.getForest();
 
 	bool calculateAttribute = false;
 
 	if (G.hasEdgeIds()) {
 		msfAttribute.clear();
 		msfAttribute.resize(G.upperEdgeIdBound(), false);
-		calculateAttribute = true;
-	}
-
-	Aux::Parallel::sort(weightedEdges.begin(), weightedEdges.end(), std::greater<weightedEdge>());
-
-	handler.assureRunning();
-
-	UnionFind uf(G.upperNodeIdBound());
-
-	for (weightedEdge e : weightedEdges) {
-		if (uf.find(e.u) != uf.find(e.v)) {
-			if (useEdgeWeights) {
-				msf.addEdge(e.u, e.v, e.attribute);
-			} else {
-				msf.addEdge(e.u, e.v);
-			}
-
-			if (calculateAttribute) {
-				msfAttribute[e.eid] = true;
-			}
-
-			uf.merge(e.u, e.v);
+		for (edgeid eid : boruvka.forestEdgeIds()) {
+			msfAttribute[eid] = true;
 		}
+		calculateAttribute = true;
 	}
 
 	handler.assureRunning();
@@ -124,7 +91,7 @@ std::string RandomMaximumSpanningForest::toString() const {
 }
 
 bool RandomMaximumSpanningForest::isParallel() const {
-	return false;
+	return true;
 }
 
 
@@ -3,15 +3,15 @@
 
 #include "Graph.h"
 #include <limits>
-#include "../structures/UnionFind.h"
+#include "BoruvkaMSF.h"
 #include "../auxiliary/Log.h"
-#include "../auxiliary/Random.h"
 #include "../base/Algorithm.h"
 
 namespace NetworKit {
 
 /**
- * Computes a random maximum-weight spanning forest using Kruskal's algorithm by randomizing the order of edges of the same weight.
+ * Computes a random maximum-weight spanning forest by randomizing the order of edges of the same weight.
+ * Uses the parallel Boruvka algorithm of BoruvkaMSF, so no edge list needs to be sorted.
  */
 class RandomMaximumSpanningForest : public Algorithm {
 public:
@@ -74,7 +74,7 @@ public:
 	Graph getMSF(bool move = false);
 
 	/**
-	 * @return false - this algorithm is not parallelized
+	 * @return true - this algorithm is parallelized
 	 */
 	virtual bool isParallel() const override;
 
@@ -84,53 +84,20 @@ public:
 	virtual std::string toString() const override;
 
 private:
-	struct weightedEdge {
-		double attribute;
-		node u;
-		node v;
-		edgeid eid;
-		index rand;
-
-		bool operator>(const weightedEdge &other) const {
-			return
-			(attribute > other.attribute)
-			||
-			(attribute == other.attribute &&
-				(rand > other.rand ||
-				(rand == other.rand && (u > other.u || (u == other.u && v > other.v)))));
-		};
-		weightedEdge(node u, node v, double attribute, edgeid eid = 0) : attribute(attribute), u(u), v(v), eid(eid), rand(Aux::Random::integer()) {};
-	};
-
 	const Graph &G;
-	std::vector<weightedEdge> weightedEdges;
+	BoruvkaMSF boruvka;
 
 	Graph msf;
 	std::vector<bool> msfAttribute;
 
-	bool hasWeightedEdges;
 	bool hasMSF;
 	bool hasAttribute;
 };
 
 template <typename A>
-RandomMaximumSpanningForest::RandomMaximumSpanningForest(const Graph &G, const std::vector< A > &attribute) : G(G), hasWeightedEdges(false), hasMSF(false), hasAttribute(false) {
-	if (!G.hasEdgeIds()) {
-		throw std::runtime_error("Error: Edges of G must be indexed for using edge attributes");
-	}
-
-	weightedEdges.reserve(G.numberOfEdges());
-
-	G.forEdges([&](node u, node v, edgeid eid) {
-		weightedEdges.emplace_back(u, v, attribute[eid], eid);
-	});
-
-	INFO(weightedEdges.size(), " weighted edges saved");
-
-	hasWeightedEdges = true;
+RandomMaximumSpanningForest::RandomMaximumSpanningForest(const Graph &G, const std::vector< A > &attribute) : G(G), boruvka(G, attribute, true, true), hasMSF(false), hasAttribute(false) {
 }
 
-
 } // namespace NetworKit
 
 #endif // RANDOMMAXIMUMSPANNINGFOREST_H
@@ -0,0 +1,349 @@
+/*
+ * StaticGraph.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#include <algorithm>
+#include <numeric>
+#include <sstream>
+#include <tuple>
+
+#include "StaticGraph.h"
+#include "GraphBuilder.h"
+
+namespace NetworKit {
+
+StaticGraph::StaticGraph() : name("StaticGraph"), z(0), n(0), m(0), storedNumberOfSelfLoops(0), omega(0), weighted(false), directed(false), edgesIndexed(false),
+	outOffsetsData(1, 0) {
+	bindOwnedStorage();
+}
+
+StaticGraph::StaticGraph(const Graph& G) : name(G.getName()), z(G.upperNodeIdBound()), n(G.numberOfNodes()), m(G.numberOfEdges()),
+	storedNumberOfSelfLoops(G.numberOfSelfLoops()), omega(G.hasEdgeIds() ? G.upperEdgeIdBound() : 0), weighted(G.isWeighted()), directed(G.isDirected()), edgesIndexed(G.hasEdgeIds()) {
+
+	if (n != z) {
+		existsData.resize(z);
+		#pragma omp parallel for
+		for (node u = 0; u < z; ++u) {
+			existsData[u] = G.hasNode(u);
+		}
+	}
+
+	const bool indexed = edgesIndexed;
+
+	// fills one CSR direction; in == true collects the incoming edges of a directed graph
+	auto build = [&](bool in, std::vector<index>& offsets, std::vector<node>& targets,
+			std::vector<edgeweight>& weights, std::vector<edgeid>& ids) {
+		offsets.assign(z + 1, 0);
+		for (node u = 0; u < z; ++u) {
+			offsets[u + 1] = offsets[u] + (G.hasNode(u) ? (in ? G.degreeIn(u) : G.degreeOut(u)) : 0);
+		}
+		targets.resize(offsets[z]);
+		if (weighted) weights.resize(offsets[z]);
+		if (indexed) ids.resize(offsets[z]);
+
+		#pragma omp parallel for schedule(guided)
+		for (node u = 0; u < z; ++u) {
+			if (!G.hasNode(u)) continue;
+			index i = offsets[u];
+			auto insert = [&](node, node v, edgeweight ew, edgeid eid) {
+				targets[i] = v;
+				if (weighted) weights[i] = ew;
+				if (indexed) ids[i] = eid;
+				++i;
+			};
+			if (in) {
+				G.forInEdgesOf(u, insert);
+			} else {
+				G.forEdgesOf(u, insert);
+			}
+		}
+
+		sortAdjacencies(z, offsets, targets, weights, ids);
+	};
+
+	build(false, outOffsetsData, outTargetsData, outWeightsData, outIdsData);
+	if (directed) {
+		build(true, inOffsetsData, inTargetsData, inWeightsData, inIdsData);
+	}
+
+	bindOwnedStorage();
+}
+
+StaticGraph::StaticGraph(count z, count n, count m, count selfLoops, edgeid omega, bool directed,
+		const uint8_t* exists,
+		const index* outOffsets, const node* outTargets, const edgeweight* outWeights, const edgeid* outIds,
+		const index* inOffsets, const node* inTargets, const edgeweight* inWeights, const edgeid* inIds,
+		std::shared_ptr<const void> storage) :
+	name("StaticGraph"), z(z), n(n), m(m), storedNumberOfSelfLoops(selfLoops), omega(outIds ? omega : 0),
+	weighted(outWeights != nullptr), directed(directed), edgesIndexed(outIds != nullptr),
+	storage(storage), exists(exists),
+	outOffsets(outOffsets), outTargets(outTargets), outWeights(outWeights), outIds(outIds),
+	inOffsets(directed ? inOffsets : outOffsets), inTargets(directed ? inTargets : outTargets),
+	inWeights(directed ? inWeights : outWeights), inIds(directed ? inIds : outIds) {
+
+	if (!storage) {
+		throw std::invalid_argument("A StaticGraph view requires an owner of the external memory");
+	}
+	if (directed && (!inOffsets || !inTargets || (outWeights && !inWeights) || (outIds && !inIds))) {
+		throw std::invalid_argument("A directed StaticGraph view requires the incoming edge arrays");
+	}
+}
+
+StaticGraph::StaticGraph(const StaticGraph& other) :
+	name(other.name), z(other.z), n(other.n), m(other.m), storedNumberOfSelfLoops(other.storedNumberOfSelfLoops),
+	omega(other.omega), weighted(other.weighted), directed(other.directed), edgesIndexed(other.edgesIndexed),
+	existsData(other.existsData), outOffsetsData(other.outOffsetsData), outTargetsData(other.outTargetsData),
+	outWeightsData(other.outWeightsData), outIdsData(other.outIdsData), inOffsetsData(other.inOffsetsData),
+	inTargetsData(other.inTargetsData), inWeightsData(other.inWeightsData), inIdsData(other.inIdsData),
+	storage(other.storage), exists(other.exists),
+	outOffsets(other.outOffsets), outTargets(other.outTargets), outWeights(other.outWeights), outIds(other.outIds),
+	inOffsets(other.inOffsets), inTargets(other.inTargets), inWeights(other.inWeights), inIds(other.inIds) {
+	if (!storage) {
+		bindOwnedStorage();
+	}
+}
+
+StaticGraph::StaticGraph(StaticGraph&& other) :
+	name(std::move(other.name)), z(other.z), n(other.n), m(other.m), storedNumberOfSelfLoops(other.storedNumberOfSelfLoops),
+	omega(other.omega), weighted(other.weighted), directed(other.directed), edgesIndexed(other.edgesIndexed),
+	existsData(std::move(other.existsData)), outOffsetsData(std::move(other.outOffsetsData)), outTargetsData(std::move(other.outTargetsData)),
+	outWeightsData(std::move(other.outWeightsData)), outIdsData(std::move(other.outIdsData)), inOffsetsData(std::move(other.inOffsetsData)),
+	inTargetsData(std::move(other.inTargetsData)), inWeightsData(std::move(other.inWeightsData)), inIdsData(std::move(other.inIdsData)),
+	storage(std::move(other.storage)), exists(other.exists),
+	outOffsets(other.outOffsets), outTargets(other.outTargets), outWeights(other.outWeights), outIds(other.outIds),
+	inOffsets(other.inOffsets), inTargets(other.inTargets), inWeights(other.inWeights), inIds(other.inIds) {
+	if (!storage) {
+		bindOwnedStorage();
+	}
+	other = StaticGraph();
+}
+
+StaticGraph& StaticGraph::operator=(const StaticGraph& other) {
+	if (this != &other) {
+		StaticGraph copy(other);
+		*this = std::move(copy);
+	}
+	return *this;
+}
+
+StaticGraph& StaticGraph::operator=(StaticGraph&& other) {
+	if (this != &other) {
+		name = std::move(other.name);
+		z = other.z;
+		n = other.n;
+		m = other.m;
+		storedNumberOfSelfLoops = other.storedNumberOfSelfLoops;
+		omega = other.omega;
+		weighted = other.weighted;
+		directed = other.directed;
+		edgesIndexed = other.edgesIndexed;
+		existsData = std::move(other.existsData);
+		outOffsetsData = std::move(other.outOffsetsData);
+		outTargetsData = std::move(other.outTargetsData);
+		outWeightsData = std::move(other.outWeightsData);
+		outIdsData = std::move(other.outIdsData);
+		inOffsetsData = std::move(other.inOffsetsData);
+		inTargetsData = std::move(other.inTargetsData);
+		inWeightsData = std::move(other.inWeightsData);
+		inIdsData = std::move(other.inIdsData);
+		storage = std::move(other.storage);
+		exists = other.exists;
+		outOffsets = other.outOffsets;
+		outTargets = other.outTargets;
+		outWeights = other.outWeights;
+		outIds = other.outIds;
+		inOffsets = other.inOffsets;
+		inTargets = other.inTargets;
+		inWeights = other.inWeights;
+		inIds = other.inIds;
+		if (!storage) {
+			bindOwnedStorage();
+		}
+
+		// leave other as valid empty graph
+		other.z = other.n = other.m = other.storedNumberOfSelfLoops = other.omega = 0;
+		other.weighted = other.directed = other.edgesIndexed = false;
+		other.storage.reset();
+		other.existsData.clear();
+		other.outOffsetsData.assign(1, 0);
+		other.outTargetsData.clear();
+		other.outWeightsData.clear();
+		other.outIdsData.clear();
+		other.inOffsetsData.clear();
+		other.inTargetsData.clear();
+		other.inWeightsData.clear();
+		other.inIdsData.clear();
+		other.bindOwnedStorage();
+	}
+	return *this;
+}
+
+void StaticGraph::bindOwnedStorage() {
+	exists = existsData.empty() ? nullptr : existsData.data();
+	outOffsets = outOffsetsData.data();
+	outTargets = outTargetsData.data();
+	outWeights = weighted ? outWeightsData.data() : nullptr;
+	outIds = edgesIndexed ? outIdsData.data() : nullptr;
+	if (directed) {
+		inOffsets = inOffsetsData.data();
+		inTargets = inTargetsData.data();
+		inWeights = weighted ? inWeightsData.data() : nullptr;
+		inIds = edgesIndexed ? inIdsData.data() : nullptr;
+	} else {
+		inOffsets = outOffsets;
+		inTargets = outTargets;
+		inWeights = outWeights;
+		inIds = outIds;
+	}
+}
+
+void StaticGraph::sortAdjacencies(count z, const std::vector<index>& offsets, std::vector<node>& targets,
+		std::vector<edgeweight>& weights, std::vector<edgeid>& ids) {
+	const bool weighted = !weights.empty();
+	const bool indexed = !ids.empty();
+
+	#pragma omp parallel
+	{
+		std::vector<std::tuple<node, edgeweight, edgeid> > buffer;
+
+		#pragma omp for schedule(guided)
+		for (node u = 0; u < z; ++u) {
+			const index begin = offsets[u];
+			const index end = offsets[u + 1];
+			if (std::is_sorted(targets.begin() + begin, targets.begin() + end)) continue;
+
+			if (!weighted && !indexed) {
+				std::sort(targets.begin() + begin, targets.begin() + end);
+				continue;
+			}
+
+			buffer.clear();
+			for (index i = begin; i < end; ++i) {
+				buffer.emplace_back(targets[i], weighted ? weights[i] : defaultEdgeWeight, indexed ? ids[i] : none);
+			}
+			std::sort(buffer.begin(), buffer.end(), [](const std::tuple<node, edgeweight, edgeid>& a, const std::tuple<node, edgeweight, edgeid>& b) {
+				return std::get<0>(a) < std::get<0>(b);
+			});
+			for (index i = begin; i < end; ++i) {
+				std::tie(targets[i], std::ignore, std::ignore) = buffer[i - begin];
+				if (weighted) weights[i] = std::get<1>(buffer[i - begin]);
+				if (indexed) ids[i] = std::get<2>(buffer[i - begin]);
+			}
+		}
+	}
+}
+
+index StaticGraph::indexInOutEdgeArray(node u, node v) const {
+	const node* begin = neighborsBegin(u);
+	const node* end = neighborsEnd(u);
+	const node* it = std::lower_bound(begin, end, v);
+	if (it == end || *it != v) {
+		return none;
+	}
+	return outOffsets[u] + (it - begin);
+}
+
+Graph StaticGraph::toGraph() const {
+	GraphBuilder builder(z, isWeighted(), directed);
+	#pragma omp parallel for schedule(guided)
+	for (node u = 0; u < z; ++u) {
+		for (index i = outOffsets[u]; i < outOffsets[u + 1]; ++i) {
+			node v = outTargets[i];
+			if (directed || u >= v) {
+				builder.addHalfEdge(u, v, isWeighted() ? outWeights[i] : defaultEdgeWeight);
+			}
+		}
+	}
+	Graph G = builder.toGraph(true, true);
+	for (node u = 0; u < z; ++u) {
+		if (!hasNode(u)) {
+			G.removeNode(u);
+		}
+	}
+	if (hasEdgeIds()) {
+		G.indexEdges();
+	}
+	G.setName(name);
+	return G;
+}
+
+std::string StaticGraph::toString() const {
+	std::stringstream strm;
+	strm << "StaticGraph(name=" << getName() << ", n=" << numberOfNodes() << ", m=" << numberOfEdges() << ")";
+	return strm.str();
+}
+
+edgeweight StaticGraph::weightedDegree(node v) const {
+	if (!isWeighted()) {
+		return defaultEdgeWeight * degree(v);
+	}
+	edgeweight sum = 0.0;
+	for (index i = outOffsets[v]; i < outOffsets[v + 1]; ++i) {
+		sum += outWeights[i];
+	}
+	return sum;
+}
+
+edgeweight StaticGraph::volume(node v) const {
+	edgeweight sum = 0.0;
+	for (index i = outOffsets[v]; i < outOffsets[v + 1]; ++i) {
+		edgeweight ew = isWeighted() ? outWeights[i] : defaultEdgeWeight;
+		sum += (outTargets[i] == v) ? 2 * ew : ew;
+	}
+	return sum;
+}
+
+edgeweight StaticGraph::weight(node u, node v) const {
+	index i = indexInOutEdgeArray(u, v);
+	if (i == none) {
+		return nullWeight;
+	}
+	return isWeighted() ? outWeights[i] : defaultEdgeWeight;
+}
+
+edgeid StaticGraph::edgeId(node u, node v) const {
+	if (!hasEdgeIds()) {
+		throw std::runtime_error("edges have not been indexed - call indexEdges first");
+	}
+	index i = indexInOutEdgeArray(u, v);
+	if (i == none) {
+		throw std::runtime_error("Edge does not exist");
+	}
+	return outIds[i];
+}
+
+edgeweight StaticGraph::totalEdgeWeight() const {
+	if (!isWeighted()) {
+		return numberOfEdges() * defaultEdgeWeight;
+	}
+	return parallelSumForEdges([&](node, node, edgeweight ew) {
+		return ew;
+	});
+}
+
+std::vector<node> StaticGraph::nodes() const {
+	std::vector<node> nodes;
+	nodes.reserve(numberOfNodes());
+	forNodes([&](node u) {
+		nodes.push_back(u);
+	});
+	return nodes;
+}
+
+std::vector<std::pair<node, node> > StaticGraph::edges() const {
+	std::vector<std::pair<node, node> > edges;
+	edges.reserve(numberOfEdges());
+	forEdges([&](node u, node v) {
+		edges.push_back(std::pair<node, node>(u, v));
+	});
+	return edges;
+}
+
+std::vector<node> StaticGraph::neighbors(node u) const {
+	return std::vector<node>(neighborsBegin(u), neighborsEnd(u));
+}
+
+} /* namespace NetworKit */
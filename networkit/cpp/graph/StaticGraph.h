@@ -0,0 +1,761 @@
+/*
+ * StaticGraph.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef STATICGRAPH_H_
+#define STATICGRAPH_H_
+
+#include <vector>
+#include <stack>
+#include <queue>
+#include <memory>
+#include <string>
+#include <cstdint>
+#include <stdexcept>
+
+#include "../Globals.h"
+#include "../auxiliary/FunctionTraits.h"
+#include "Graph.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup graph
+ * An immutable graph stored in compressed sparse row (CSR) format.
+ *
+ * The adjacency of all nodes is kept in one contiguous array of targets (plus optional
+ * contiguous arrays of weights and edge ids) which is indexed by an offset array of length
+ * upperNodeIdBound() + 1. Compared to Graph this avoids one heap allocation per node and the
+ * corresponding pointer chasing during iteration, which roughly halves the memory footprint
+ * of read-only workloads. The neighbors of every node are sorted by node id, so hasEdge,
+ * weight and edgeId run in O(log deg).
+ *
+ * StaticGraph offers the same node, edge and neighborhood iterators as Graph (forNodes, forEdges,
+ * parallelForEdges, forNeighborsOf, ...) with the same lambda signatures, so templated code can
+ * be instantiated on either type. Like in Graph, undirected edges are stored in the adjacency of
+ * both endpoints and directed graphs additionally store the incoming edges.
+ *
+ * The arrays can either be owned by the StaticGraph or live in external memory (e.g. a memory
+ * mapped file), in which case the StaticGraph is a read-only view that keeps the external memory
+ * alive through a shared pointer.
+ */
+class StaticGraph final {
+
+	friend class NetworkitBinaryWriter;
+
+public:
+
+	/**
+	 * Create an empty static graph.
+	 */
+	StaticGraph();
+
+	/**
+	 * Create a static graph as frozen copy of @a G. Node ids and, if @a G has indexed edges,
+	 * edge ids are preserved.
+	 *
+	 * @param G The graph to copy.
+	 */
+	explicit StaticGraph(const Graph& G);
+
+	/**
+	 * Create a static graph as read-only view on external CSR arrays. Nothing is copied, the
+	 * arrays must stay valid as long as @a storage is alive.
+	 *
+	 * @param z Upper bound of the node ids, the offset arrays have length @a z + 1.
+	 * @param n Number of nodes.
+	 * @param m Number of edges.
+	 * @param selfLoops Number of self-loops.
+	 * @param omega Upper bound of the edge ids (only relevant if @a outIds is not null).
+	 * @param directed If set to @c true, the graph is directed and the in-arrays must be given.
+	 * @param exists Array of length @a z flagging existing nodes, or @c nullptr if all nodes exist.
+	 * @param outOffsets Offsets into the outgoing adjacency arrays.
+	 * @param outTargets Sorted outgoing neighbors of every node.
+	 * @param outWeights Weights of the outgoing edges or @c nullptr for an unweighted graph.
+	 * @param outIds Ids of the outgoing edges or @c nullptr if edges are not indexed.
+	 * @param inOffsets Offsets into the incoming adjacency arrays (directed graphs only).
+	 * @param inTargets Sorted incoming neighbors of every node (directed graphs only).
+	 * @param inWeights Weights of the incoming edges (directed and weighted graphs only).
+	 * @param inIds Ids of the incoming edges (directed graphs with edge ids only).
+	 * @param storage Owner of the external memory.
+	 */
+	StaticGraph(count z, count n, count m, count selfLoops, edgeid omega, bool directed,
+		const uint8_t* exists,
+		const index* outOffsets, const node* outTargets, const edgeweight* outWeights, const edgeid* outIds,
+		const index* inOffsets, const node* inTargets, const edgeweight* inWeights, const edgeid* inIds,
+		std::shared_ptr<const void> storage);
+
+	StaticGraph(const StaticGraph& other);
+
+	StaticGraph(StaticGraph&& other);
+
+	~StaticGraph() = default;
+
+	StaticGraph& operator=(const StaticGraph& other);
+
+	StaticGraph& operator=(StaticGraph&& other);
+
+	/**
+	 * Creates a (dynamic) Graph with the same nodes and edges. If edges are indexed, the
+	 * edges of the returned graph are indexed as well, but the ids might be reassigned.
+	 */
+	Graph toGraph() const;
+
+	/** GRAPH INFORMATION **/
+
+	/**
+	 * Set name of graph to @a name.
+	 */
+	void setName(std::string name) { this->name = name; }
+
+	/**
+	 * Returns the name of the graph.
+	 */
+	std::string getName() const { return name; }
+
+	/**
+	 * Returns a string representation of the graph.
+	 */
+	std::string toString() const;
+
+	/**
+	 * Return @c true if the CSR arrays are owned by external memory.
+	 */
+	bool isView() const { return storage != nullptr; }
+
+	bool isWeighted() const { return weighted; }
+
+	bool isDirected() const { return directed; }
+
+	bool hasEdgeIds() const { return edgesIndexed; }
+
+	bool isEmpty() const { return n == 0; }
+
+	count numberOfNodes() const { return n; }
+
+	count numberOfEdges() const { return m; }
+
+	count numberOfSelfLoops() const { return storedNumberOfSelfLoops; }
+
+	index upperNodeIdBound() const { return z; }
+
+	index upperEdgeIdBound() const { return omega; }
+
+	bool hasNode(node v) const { return v < z && (exists == nullptr || exists[v]); }
+
+	/** NODE PROPERTIES **/
+
+	/**
+	 * Returns the number of outgoing neighbors of @a v.
+	 */
+	count degree(node v) const { return outOffsets[v + 1] - outOffsets[v]; }
+
+	count degreeOut(node v) const { return degree(v); }
+
+	/**
+	 * Returns the number of incoming neighbors of @a v, for undirected graphs the degree.
+	 */
+	count degreeIn(node v) const { return inOffsets[v + 1] - inOffsets[v]; }
+
+	bool isIsolated(node v) const { return degree(v) == 0 && degreeIn(v) == 0; }
+
+	/**
+	 * Returns the weighted degree of @a v. For directed graphs only outgoing edges count.
+	 */
+	edgeweight weightedDegree(node v) const;
+
+	/**
+	 * Returns the volume of @a v, which is the weighted degree with self-loops counted twice.
+	 */
+	edgeweight volume(node v) const;
+
+	/** EDGE PROPERTIES **/
+
+	/**
+	 * Checks if the edge (@a u, @a v) exists. Runs in O(log deg(u)).
+	 */
+	bool hasEdge(node u, node v) const { return indexInOutEdgeArray(u, v) != none; }
+
+	/**
+	 * Returns the weight of edge (@a u, @a v) or 0 if it does not exist. Runs in O(log deg(u)).
+	 */
+	edgeweight weight(node u, node v) const;
+
+	/**
+	 * Returns the id of edge (@a u, @a v). Runs in O(log deg(u)).
+	 */
+	edgeid edgeId(node u, node v) const;
+
+	/**
+	 * Returns the sum of all edge weights.
+	 */
+	edgeweight totalEdgeWeight() const;
+
+	/** COLLECTIONS **/
+
+	std::vector<node> nodes() const;
+
+	std::vector<std::pair<node, node> > edges() const;
+
+	std::vector<node> neighbors(node u) const;
+
+	/** RAW CSR ACCESS **/
+
+	/**
+	 * Returns a pointer to the first (outgoing) neighbor of @a u. The neighbors of @a u are
+	 * stored contiguously in ascending order up to neighborsEnd(u).
+	 */
+	const node* neighborsBegin(node u) const { return outTargets + outOffsets[u]; }
+
+	const node* neighborsEnd(node u) const { return outTargets + outOffsets[u + 1]; }
+
+	const node* inNeighborsBegin(node u) const { return inTargets + inOffsets[u]; }
+
+	const node* inNeighborsEnd(node u) const { return inTargets + inOffsets[u + 1]; }
+
+	/* NODE ITERATORS */
+
+	template<typename L> void forNodes(L handle) const;
+
+	template<typename L> void parallelForNodes(L handle) const;
+
+	template<typename C, typename L> void forNodesWhile(C condition, L handle) const;
+
+	template<typename L> void balancedParallelForNodes(L handle) const;
+
+	template<typename L> void forNodePairs(L handle) const;
+
+	template<typename L> void parallelForNodePairs(L handle) const;
+
+	/* EDGE ITERATORS */
+
+	/**
+	 * Iterate over all edges and call @a handle, see Graph::forEdges.
+	 */
+	template<typename L> void forEdges(L handle) const;
+
+	/**
+	 * Iterate in parallel over all edges and call @a handle, see Graph::parallelForEdges.
+	 */
+	template<typename L> void parallelForEdges(L handle) const;
+
+	/* NEIGHBORHOOD ITERATORS */
+
+	template<typename L> void forNeighborsOf(node u, L handle) const;
+
+	template<typename L> void forEdgesOf(node u, L handle) const;
+
+	template<typename L> void forInNeighborsOf(node u, L handle) const;
+
+	template<typename L> void forInEdgesOf(node u, L handle) const;
+
+	/* REDUCTION ITERATORS */
+
+	template<typename L> double parallelSumForNodes(L handle) const;
+
+	template<typename L> double parallelSumForEdges(L handle) const;
+
+	/* GRAPH SEARCHES */
+
+	template<typename L> void BFSfrom(node r, L handle) const;
+
+	template<typename L> void DFSfrom(node r, L handle) const;
+
+private:
+	std::string name;
+
+	count z; //!< upper bound of node ids
+	count n; //!< number of nodes
+	count m; //!< number of edges
+	count storedNumberOfSelfLoops;
+	edgeid omega; //!< upper bound of edge ids
+	bool weighted;
+	bool directed;
+	bool edgesIndexed;
+
+	// owned storage, empty if the graph is a view on external memory
+	std::vector<uint8_t> existsData;
+	std::vector<index> outOffsetsData;
+	std::vector<node> outTargetsData;
+	std::vector<edgeweight> outWeightsData;
+	std::vector<edgeid> outIdsData;
+	std::vector<index> inOffsetsData;
+	std::vector<node> inTargetsData;
+	std::vector<edgeweight> inWeightsData;
+	std::vector<edgeid> inIdsData;
+
+	// keeps external memory alive, null if the arrays are owned
+	std::shared_ptr<const void> storage;
+
+	// the arrays used by all accessors; for undirected graphs the in-arrays alias the out-arrays
+	const uint8_t* exists;
+	const index* outOffsets;
+	const node* outTargets;
+	const edgeweight* outWeights;
+	const edgeid* outIds;
+	const index* inOffsets;
+	const node* inTargets;
+	const edgeweight* inWeights;
+	const edgeid* inIds;
+
+	/**
+	 * Points the array pointers to the owned storage.
+	 */
+	void bindOwnedStorage();
+
+	/**
+	 * Sorts the adjacency of every node by target id.
+	 */
+	static void sortAdjacencies(count z, const std::vector<index>& offsets, std::vector<node>& targets,
+		std::vector<edgeweight>& weights, std::vector<edgeid>& ids);
+
+	/**
+	 * Returns the position of @a v in the array of outgoing edges or @c none.
+	 */
+	index indexInOutEdgeArray(node u, node v) const;
+
+	template<bool hasWeights>
+	inline edgeweight getWeight(const edgeweight* weights, index i) const { return weights[i]; }
+
+	template<bool graphHasEdgeIds>
+	inline edgeid getId(const edgeid* ids, index i) const { return ids[i]; }
+
+	template<bool graphIsDirected>
+	inline bool useEdgeInIteration(node u, node v) const { return graphIsDirected || u >= v; }
+
+	template<bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+	inline void forAdjacencyImpl(node u, const index* offsets, const node* targets,
+		const edgeweight* weights, const edgeid* ids, L& handle) const;
+
+	template<bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+	inline void forEdgeImpl(L handle) const;
+
+	template<bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+	inline void parallelForEdgesImpl(L handle) const;
+
+	template<bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+	inline double parallelSumForEdgesImpl(L handle) const;
+
+	/*
+	 * The edgeLambda overloads select the lambda signature exactly like Graph::edgeLambda.
+	 */
+
+	template<class F, void* = (void*)0>
+	typename Aux::FunctionTraits<F>::result_type edgeLambda(F&f, ...) const {
+		static_assert(! std::is_same<F, F>::value, "Your lambda does not support the required parameters or the parameters have the wrong type.");
+		return std::declval<typename Aux::FunctionTraits<F>::result_type>();
+	}
+
+	template < class F,
+	         typename std::enable_if <
+	         (Aux::FunctionTraits<F>::arity >= 3) &&
+	         std::is_same<edgeweight, typename Aux::FunctionTraits<F>::template arg<2>::type>::value &&
+	         std::is_same<edgeid, typename Aux::FunctionTraits<F>::template arg<3>::type>::value
+	         >::type * = (void*)0 >
+	auto edgeLambda(F &f, node u, node v, edgeweight ew, edgeid id) const -> decltype(f(u, v, ew, id)) {
+		return f(u, v, ew, id);
+	}
+
+	template<class F,
+			 typename std::enable_if<
+			 (Aux::FunctionTraits<F>::arity >= 2) &&
+			 std::is_same<edgeid, typename Aux::FunctionTraits<F>::template arg<2>::type>::value &&
+			 std::is_same<node, typename Aux::FunctionTraits<F>::template arg<1>::type>::value
+			 >::type* = (void*)0>
+	auto edgeLambda(F&f, node u, node v, edgeweight ew, edgeid id) const -> decltype(f(u, v, id)) {
+		return f(u, v, id);
+	}
+
+	template<class F,
+			 typename std::enable_if<
+			 (Aux::FunctionTraits<F>::arity >= 2) &&
+			 std::is_same<edgeweight, typename Aux::FunctionTraits<F>::template arg<2>::type>::value
+			 >::type* = (void*)0>
+	auto edgeLambda(F&f, node u, node v, edgeweight ew, edgeid id) const -> decltype(f(u, v, ew)) {
+		return f(u, v, ew);
+	}
+
+	template<class F,
+			 typename std::enable_if<
+			 (Aux::FunctionTraits<F>::arity >= 1) &&
+			 std::is_same<node, typename Aux::FunctionTraits<F>::template arg<1>::type>::value
+			 >::type* = (void*)0>
+	auto edgeLambda(F&f, node u, node v, edgeweight ew, edgeid id) const -> decltype(f(u, v)) {
+			return f(u, v);
+	}
+
+	template<class F,
+			 typename std::enable_if<
+			 (Aux::FunctionTraits<F>::arity >= 1) &&
+			 std::is_same<edgeweight, typename Aux::FunctionTraits<F>::template arg<1>::type>::value
+			 >::type* = (void*)0>
+	auto edgeLambda(F&f, node u, node v, edgeweight ew, edgeid id) const -> decltype(f(u, ew)) {
+		return f(v, ew);
+	}
+
+	template<class F,
+			 void* = (void*)0>
+	auto edgeLambda(F&f, node u, node v, edgeweight ew, edgeid id) const -> decltype(f(v)) {
+		return f(v);
+	}
+
+	template <class F>
+	auto callBFSHandle(F &f, node u, count dist) const -> decltype(f(u, dist)) {
+		return f(u, dist);
+	}
+
+	template <class F>
+	auto callBFSHandle(F &f, node u, count dist) const -> decltype(f(u)) {
+		return f(u);
+	}
+};
+
+/* HELPERS */
+
+template<>
+inline edgeweight StaticGraph::getWeight<false>(const edgeweight*, index) const {
+	return defaultEdgeWeight;
+}
+
+template<>
+inline edgeid StaticGraph::getId<false>(const edgeid*, index) const {
+	return 0;
+}
+
+template<bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+inline void StaticGraph::forAdjacencyImpl(node u, const index* offsets, const node* targets,
+		const edgeweight* weights, const edgeid* ids, L& handle) const {
+	const index end = offsets[u + 1];
+	for (index i = offsets[u]; i < end; ++i) {
+		node v = targets[i];
+		if (useEdgeInIteration<graphIsDirected>(u, v)) {
+			edgeLambda<L>(handle, u, v, getWeight<hasWeights>(weights, i), getId<graphHasEdgeIds>(ids, i));
+		}
+	}
+}
+
+template<bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+inline void StaticGraph::forEdgeImpl(L handle) const {
+	for (node u = 0; u < z; ++u) {
+		forAdjacencyImpl<graphIsDirected, hasWeights, graphHasEdgeIds, L>(u, outOffsets, outTargets, outWeights, outIds, handle);
+	}
+}
+
+template<bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+inline void StaticGraph::parallelForEdgesImpl(L handle) const {
+	#pragma omp parallel for schedule(guided)
+	for (node u = 0; u < z; ++u) {
+		forAdjacencyImpl<graphIsDirected, hasWeights, graphHasEdgeIds, L>(u, outOffsets, outTargets, outWeights, outIds, handle);
+	}
+}
+
+template<bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+inline double StaticGraph::parallelSumForEdgesImpl(L handle) const {
+	double sum = 0.0;
+	#pragma omp parallel for schedule(guided) reduction(+:sum)
+	for (node u = 0; u < z; ++u) {
+		const index end = outOffsets[u + 1];
+		for (index i = outOffsets[u]; i < end; ++i) {
+			node v = outTargets[i];
+			if (useEdgeInIteration<graphIsDirected>(u, v)) {
+				sum += edgeLambda<L>(handle, u, v, getWeight<hasWeights>(outWeights, i), getId<graphHasEdgeIds>(outIds, i));
+			}
+		}
+	}
+	return sum;
+}
+
+/* NODE ITERATORS */
+
+template<typename L>
+void StaticGraph::forNodes(L handle) const {
+	for (node v = 0; v < z; ++v) {
+		if (hasNode(v)) {
+			handle(v);
+		}
+	}
+}
+
+template<typename L>
+void StaticGraph::parallelForNodes(L handle) const {
+	#pragma omp parallel for
+	for (node v = 0; v < z; ++v) {
+		if (hasNode(v)) {
+			handle(v);
+		}
+	}
+}
+
+template<typename C, typename L>
+void StaticGraph::forNodesWhile(C condition, L handle) const {
+	for (node v = 0; v < z; ++v) {
+		if (hasNode(v)) {
+			if (!condition()) {
+				break;
+			}
+			handle(v);
+		}
+	}
+}
+
+template<typename L>
+void StaticGraph::balancedParallelForNodes(L handle) const {
+	#pragma omp parallel for schedule(guided)
+	for (node v = 0; v < z; ++v) {
+		if (hasNode(v)) {
+			handle(v);
+		}
+	}
+}
+
+template<typename L>
+void StaticGraph::forNodePairs(L handle) const {
+	for (node u = 0; u < z; ++u) {
+		if (hasNode(u)) {
+			for (node v = u + 1; v < z; ++v) {
+				if (hasNode(v)) {
+					handle(u, v);
+				}
+			}
+		}
+	}
+}
+
+template<typename L>
+void StaticGraph::parallelForNodePairs(L handle) const {
+	#pragma omp parallel for schedule(guided)
+	for (node u = 0; u < z; ++u) {
+		if (hasNode(u)) {
+			for (node v = u + 1; v < z; ++v) {
+				if (hasNode(v)) {
+					handle(u, v);
+				}
+			}
+		}
+	}
+}
+
+/* EDGE ITERATORS */
+
+template<typename L>
+void StaticGraph::forEdges(L handle) const {
+	switch (isWeighted() + 2 * directed + 4 * hasEdgeIds()) {
+	case 0: // unweighted, undirected, no edgeIds
+		forEdgeImpl<false, false, false, L>(handle);
+		break;
+
+	case 1: // weighted,   undirected, no edgeIds
+		forEdgeImpl<false, true, false, L>(handle);
+		break;
+
+	case 2: // unweighted, directed, no edgeIds
+		forEdgeImpl<true, false, false, L>(handle);
+		break;
+
+	case 3: // weighted, directed, no edgeIds
+		forEdgeImpl<true, true, false, L>(handle);
+		break;
+
+	case 4: // unweighted, undirected, with edgeIds
+		forEdgeImpl<false, false, true, L>(handle);
+		break;
+
+	case 5: // weighted,   undirected, with edgeIds
+		forEdgeImpl<false, true, true, L>(handle);
+		break;
+
+	case 6: // unweighted, directed, with edgeIds
+		forEdgeImpl<true, false, true, L>(handle);
+		break;
+
+	case 7: // weighted,   directed, with edgeIds
+		forEdgeImpl<true, true, true, L>(handle);
+		break;
+	}
+}
+
+template<typename L>
+void StaticGraph::parallelForEdges(L handle) const {
+	switch (isWeighted() + 2 * directed + 4 * hasEdgeIds()) {
+	case 0: // unweighted, undirected, no edgeIds
+		parallelForEdgesImpl<false, false, false, L>(handle);
+		break;
+
+	case 1: // weighted,   undirected, no edgeIds
+		parallelForEdgesImpl<false, true, false, L>(handle);
+		break;
+
+	case 2: // unweighted, directed, no edgeIds
+		parallelForEdgesImpl<true, false, false, L>(handle);
+		break;
+
+	case 3: // weighted, directed, no edgeIds
+		parallelForEdgesImpl<true, true, false, L>(handle);
+		break;
+
+	case 4: // unweighted, undirected, with edgeIds
+		parallelForEdgesImpl<false, false, true, L>(handle);
+		break;
+
+	case 5: // weighted,   undirected, with edgeIds
+		parallelForEdgesImpl<false, true, true, L>(handle);
+		break;
+
+	case 6: // unweighted, directed, with edgeIds
+		parallelForEdgesImpl<true, false, true, L>(handle);
+		break;
+
+	case 7: // weighted,   directed, with edgeIds
+		parallelForEdgesImpl<true, true, true, L>(handle);
+		break;
+	}
+}
+
+/* NEIGHBORHOOD ITERATORS */
+
+template<typename L>
+void StaticGraph::forNeighborsOf(node u, L handle) const {
+	forEdgesOf(u, handle);
+}
+
+template<typename L>
+void StaticGraph::forEdgesOf(node u, L handle) const {
+	switch (isWeighted() + 2 * hasEdgeIds()) {
+	case 0: //not weighted, no edge ids
+		forAdjacencyImpl<true, false, false, L>(u, outOffsets, outTargets, outWeights, outIds, handle);
+		break;
+
+	case 1:	//weighted, no edge ids
+		forAdjacencyImpl<true, true, false, L>(u, outOffsets, outTargets, outWeights, outIds, handle);
+		break;
+
+	case 2: //not weighted, with edge ids
+		forAdjacencyImpl<true, false, true, L>(u, outOffsets, outTargets, outWeights, outIds, handle);
+		break;
+
+	case 3:	//weighted, with edge ids
+		forAdjacencyImpl<true, true, true, L>(u, outOffsets, outTargets, outWeights, outIds, handle);
+		break;
+	}
+}
+
+template<typename L>
+void StaticGraph::forInNeighborsOf(node u, L handle) const {
+	forInEdgesOf(u, handle);
+}
+
+template<typename L>
+void StaticGraph::forInEdgesOf(node u, L handle) const {
+	// for undirected graphs the in-arrays alias the out-arrays
+	switch (isWeighted() + 2 * hasEdgeIds()) {
+	case 0: //not weighted, no edge ids
+		forAdjacencyImpl<true, false, false, L>(u, inOffsets, inTargets, inWeights, inIds, handle);
+		break;
+
+	case 1:	//weighted, no edge ids
+		forAdjacencyImpl<true, true, false, L>(u, inOffsets, inTargets, inWeights, inIds, handle);
+		break;
+
+	case 2: //not weighted, with edge ids
+		forAdjacencyImpl<true, false, true, L>(u, inOffsets, inTargets, inWeights, inIds, handle);
+		break;
+
+	case 3:	//weighted, with edge ids
+		forAdjacencyImpl<true, true, true, L>(u, inOffsets, inTargets, inWeights, inIds, handle);
+		break;
+	}
+}
+
+/* REDUCTION ITERATORS */
+
+template<typename L>
+double StaticGraph::parallelSumForNodes(L handle) const {
+	double sum = 0.0;
+	#pragma omp parallel for reduction(+:sum)
+	for (node v = 0; v < z; ++v) {
+		if (hasNode(v)) {
+			sum += handle(v);
+		}
+	}
+	return sum;
+}
+
+template<typename L>
+double StaticGraph::parallelSumForEdges(L handle) const {
+	switch (isWeighted() + 2 * directed + 4 * hasEdgeIds()) {
+	case 0: // unweighted, undirected, no edge ids
+		return parallelSumForEdgesImpl<false, false, false, L>(handle);
+
+	case 1: // weighted,   undirected, no edge ids
+		return parallelSumForEdgesImpl<false, true, false, L>(handle);
+
+	case 2: // unweighted, directed, no edge ids
+		return parallelSumForEdgesImpl<true, false, false, L>(handle);
+
+	case 3: // weighted,   directed, no edge ids
+		return parallelSumForEdgesImpl<true, true, false, L>(handle);
+
+	case 4: // unweighted, undirected, with edge ids
+		return parallelSumForEdgesImpl<false, false, true, L>(handle);
+
+	case 5: // weighted,   undirected, with edge ids
+		return parallelSumForEdgesImpl<false, true, true, L>(handle);
+
+	case 6: // unweighted, directed, with edge ids
+		return parallelSumForEdgesImpl<true, false, true, L>(handle);
+
+	default: // weighted,   directed, with edge ids
+		return parallelSumForEdgesImpl<true, true, true, L>(handle);
+	}
+}
+
+/* GRAPH SEARCHES */
+
+template<typename L>
+void StaticGraph::BFSfrom(node r, L handle) const {
+	std::vector<bool> marked(z);
+	std::vector<node> q, qNext;
+	count dist = 0;
+	q.push_back(r);
+	marked[r] = true;
+	while (!q.empty()) {
+		for (node u : q) {
+			callBFSHandle(handle, u, dist);
+			for (const node* it = neighborsBegin(u); it != neighborsEnd(u); ++it) {
+				if (!marked[*it]) {
+					qNext.push_back(*it);
+					marked[*it] = true;
+				}
+			}
+		}
+		q.swap(qNext);
+		qNext.clear();
+		++dist;
+	}
+}
+
+template<typename L>
+void StaticGraph::DFSfrom(node r, L handle) const {
+	std::vector<bool> marked(z);
+	std::stack<node> s;
+	s.push(r);
+	marked[r] = true;
+	do {
+		node u = s.top();
+		s.pop();
+		handle(u);
+		for (const node* it = neighborsBegin(u); it != neighborsEnd(u); ++it) {
+			if (!marked[*it]) {
+				s.push(*it);
+				marked[*it] = true;
+			}
+		}
+	} while (!s.empty());
+}
+
+} /* namespace NetworKit */
+
+#endif /* STATICGRAPH_H_ */
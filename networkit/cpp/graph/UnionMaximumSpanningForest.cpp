@@ -2,6 +2,7 @@
 #include "UnionMaximumSpanningForest.h"
 #include "../auxiliary/SignalHandling.h"
 #include "../auxiliary/Parallel.h"
+#include "../structures/ConcurrentUnionFind.h"
 
 namespace NetworKit {
 
@@ -45,35 +46,45 @@ void UnionMaximumSpanningForest::run() {
 
 	handler.assureRunning();
 
-	edgeweight currentAttribute = std::numeric_limits<edgeweight>::max();
+	// an edge is in some maximum-weight spanning forest iff its endpoints are not connected by strictly heavier edges,
+	// so all edges of the same weight are checked and then merged in parallel
+	std::vector<char> candidate(weightedEdges.size(), 0);
+	ConcurrentUnionFind uf(G.upperNodeIdBound());
 
-	std::vector<std::pair<node, node> > nodesToMerge;
-	UnionFind uf(G.upperNodeIdBound());
-
-	for (weightedEdge e : weightedEdges) {
-		if (e.attribute != currentAttribute) {
-			for (auto candidate : nodesToMerge) {
-				uf.merge(candidate.first, candidate.second);
-			}
-
-			nodesToMerge.clear();
-			currentAttribute = e.attribute;
+	for (index begin = 0, end = 0; begin < weightedEdges.size(); begin = end) {
+		while (end < weightedEdges.size() && weightedEdges[end].attribute == weightedEdges[begin].attribute) {
+			++end;
 		}
 
+#pragma omp parallel for if (end - begin > 1024)
+		for (index i = begin; i < end; ++i) {
+			candidate[i] = uf.find(weightedEdges[i].u) != uf.find(weightedEdges[i].v);
+		}
 
-		if (uf.find(e.u) != uf.find(e.v)) {
-			if (useEdgeWeights) {
-				umsf.addEdge(e.u, e.v, e.attribute);
-			} else {
-				umsf.addEdge(e.u, e.v);
+#pragma omp parallel for if (end - begin > 1024)
+		for (index i = begin; i < end; ++i) {
+			if (candidate[i]) {
+				uf.merge(weightedEdges[i].u, weightedEdges[i].v);
 			}
+		}
+	}
 
-			if (calculateAttribute) {
-				umsfAttribute[e.eid] = true;
-			}
+	handler.assureRunning();
 
-			nodesToMerge.emplace_back(e.u, e.v);
+	for (index i = 0; i < weightedEdges.size(); ++i) {
+		if (!candidate[i]) {
+			continue;
+		}
+
+		const weightedEdge &e = weightedEdges[i];
+		if (useEdgeWeights) {
+			umsf.addEdge(e.u, e.v, e.attribute);
+		} else {
+			umsf.addEdge(e.u, e.v);
+		}
 
+		if (calculateAttribute) {
+			umsfAttribute[e.eid] = true;
 		}
 	}
 
@@ -135,7 +146,7 @@ std::string UnionMaximumSpanningForest::toString() const {
 }
 
 bool UnionMaximumSpanningForest::isParallel() const {
-	return false;
+	return true;
 }
 
 
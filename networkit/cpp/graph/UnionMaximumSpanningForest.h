@@ -73,7 +73,7 @@ public:
 	Graph getUMSF(bool move = false);
 
 	/**
-	 * @return false - this algorithm is not parallelized.
+	 * @return true - edges of the same weight are processed in parallel.
 	 */
 	virtual bool isParallel() const override;
 
@@ -9,6 +9,7 @@
 
 #include "GraphBenchmark.h"
 #include "../../auxiliary/Log.h"
+#include "../../generators/BarabasiAlbertGenerator.h"
 
 namespace NetworKit {
 
@@ -138,6 +139,39 @@ TEST_F(GraphBenchmark, edgeInsertions_standard_seq) {
 //
 //}
 
+// TASK: edge lookups on power-law graphs, linear scan vs. binary search in sorted adjacency arrays
+
+TEST_F(GraphBenchmark, edgeIdLookup_powerLaw) {
+	BarabasiAlbertGenerator gen(10, 100 * this->n);
+	Graph G = gen.generate();
+	G.indexEdges();
+
+	std::vector<std::pair<node, node>> edges;
+	edges.reserve(2 * G.numberOfEdges());
+	G.forEdges([&](node u, node v) {
+		edges.emplace_back(u, v);
+		edges.emplace_back(v, u);
+	});
+
+	auto lookupAll = [&]() {
+		Aux::Timer runtime;
+		edgeid sum = 0;
+		runtime.start();
+		for (auto e : edges) {
+			sum += G.edgeId(e.first, e.second);
+		}
+		runtime.stop();
+		INFO("edgeId of ", edges.size(), " edges: ", runtime.elapsed().count(), " ms");
+		return sum;
+	};
+
+	edgeid unsortedSum = lookupAll();
+	G.sortEdges();
+	ASSERT_TRUE(G.hasSortedEdges());
+	edgeid sortedSum = lookupAll();
+
+	EXPECT_EQ(unsortedSum, sortedSum);
+}
 
 
 
@@ -11,6 +11,7 @@
 
 #include "GraphGTest.h"
 #include "../GraphBuilder.h"
+#include "../StaticGraph.h"
 #include "../../io/METISGraphReader.h"
 #include "../../auxiliary/NumericTools.h"
 #include "../../graph/DynBFS.h"
@@ -2157,6 +2158,184 @@ TEST_P(GraphGTest, testSortEdges) {
 	}
 }
 
+TEST_P(GraphGTest, testAddNodeToIndexedGraph) {
+	Graph G = this->Ghouse;
+	G.indexEdges();
+	count m = G.upperEdgeIdBound();
+
+	node x = G.addNode();
+	node y = G.addNode();
+	G.addEdge(x, y);
+	G.addEdge(0, x);
+
+	EXPECT_EQ(m + 2, G.upperEdgeIdBound());
+	EXPECT_EQ(m, G.edgeId(x, y));
+	EXPECT_EQ(m + 1, G.edgeId(0, x));
+	if (!G.isDirected()) {
+		EXPECT_EQ(m, G.edgeId(y, x));
+		EXPECT_EQ(m + 1, G.edgeId(x, 0));
+	}
+}
+
+TEST_P(GraphGTest, testEdgeLookupOnSortedEdges) {
+	Graph G = this->Ghouse;
+	G.indexEdges();
+	Graph origG = G;
+
+	EXPECT_FALSE(G.hasSortedEdges());
+	G.sortEdges();
+	EXPECT_TRUE(G.hasSortedEdges());
+
+	origG.forEdges([&](node u, node v, edgeweight w, edgeid eid) {
+		EXPECT_TRUE(G.hasEdge(u, v));
+		EXPECT_EQ(w, G.weight(u, v));
+		EXPECT_EQ(eid, G.edgeId(u, v));
+	});
+	G.forNodePairs([&](node u, node v) {
+		EXPECT_EQ(origG.hasEdge(u, v), G.hasEdge(u, v));
+		EXPECT_EQ(origG.hasEdge(v, u), G.hasEdge(v, u));
+	});
+
+	// appending the largest neighbor keeps the order, anything else drops it
+	node x = G.addNode();
+	G.addEdge(0, x);
+	EXPECT_TRUE(G.hasSortedEdges());
+	EXPECT_TRUE(G.hasEdge(0, x));
+	G.addEdge(0, 1);
+	EXPECT_FALSE(G.hasSortedEdges());
+	EXPECT_TRUE(G.hasEdge(0, x));
+
+	G.sortEdges();
+	G.removeEdge(0, x);
+	EXPECT_FALSE(G.hasSortedEdges());
+	EXPECT_FALSE(G.hasEdge(0, x));
+	EXPECT_TRUE(G.hasEdge(0, 1));
+}
+
+/** STATIC GRAPH **/
+
+TEST_P(GraphGTest, testStaticGraphFromGraph) {
+	Graph G = this->Ghouse;
+	G.addEdge(2, 2, 3.0);
+	StaticGraph S(G);
+
+	ASSERT_EQ(G.isWeighted(), S.isWeighted());
+	ASSERT_EQ(G.isDirected(), S.isDirected());
+	ASSERT_EQ(G.numberOfNodes(), S.numberOfNodes());
+	ASSERT_EQ(G.numberOfEdges(), S.numberOfEdges());
+	ASSERT_EQ(G.numberOfSelfLoops(), S.numberOfSelfLoops());
+	ASSERT_EQ(G.upperNodeIdBound(), S.upperNodeIdBound());
+	ASSERT_DOUBLE_EQ(G.totalEdgeWeight(), S.totalEdgeWeight());
+
+	G.forNodes([&](node u) {
+		ASSERT_EQ(G.degree(u), S.degree(u));
+		ASSERT_EQ(G.degreeIn(u), S.degreeIn(u));
+		ASSERT_DOUBLE_EQ(G.weightedDegree(u), S.weightedDegree(u));
+		ASSERT_DOUBLE_EQ(G.volume(u), S.volume(u));
+
+		std::vector<node> neighbors = G.neighbors(u);
+		std::sort(neighbors.begin(), neighbors.end());
+		ASSERT_EQ(neighbors, S.neighbors(u));
+
+		std::vector<node> inNeighbors;
+		G.forInNeighborsOf(u, [&](node v) {
+			inNeighbors.push_back(v);
+		});
+		std::sort(inNeighbors.begin(), inNeighbors.end());
+		std::vector<node> staticInNeighbors;
+		S.forInNeighborsOf(u, [&](node v) {
+			staticInNeighbors.push_back(v);
+		});
+		ASSERT_EQ(inNeighbors, staticInNeighbors);
+	});
+
+	G.forNodePairs([&](node u, node v) {
+		ASSERT_EQ(G.hasEdge(u, v), S.hasEdge(u, v));
+		ASSERT_EQ(G.hasEdge(v, u), S.hasEdge(v, u));
+		ASSERT_EQ(G.weight(u, v), S.weight(u, v));
+	});
+
+	std::vector<std::pair<node, node> > edges = G.edges();
+	std::vector<std::pair<node, node> > staticEdges = S.edges();
+	std::sort(edges.begin(), edges.end());
+	std::sort(staticEdges.begin(), staticEdges.end());
+	ASSERT_EQ(edges, staticEdges);
+
+	edgeweight sum = S.parallelSumForEdges([](node, node, edgeweight ew) {
+		return ew;
+	});
+	ASSERT_DOUBLE_EQ(G.totalEdgeWeight(), sum);
+
+	count edgeCount = 0;
+	S.parallelForEdges([&](node, node) {
+		#pragma omp atomic
+		edgeCount++;
+	});
+	ASSERT_EQ(G.numberOfEdges(), edgeCount);
+}
+
+TEST_P(GraphGTest, testStaticGraphEdgeIds) {
+	Graph G = this->Ghouse;
+	G.indexEdges();
+	StaticGraph S(G);
+
+	ASSERT_TRUE(S.hasEdgeIds());
+	ASSERT_EQ(G.upperEdgeIdBound(), S.upperEdgeIdBound());
+	S.forEdges([&](node u, node v, edgeid eid) {
+		ASSERT_EQ(G.edgeId(u, v), eid);
+		ASSERT_EQ(G.edgeId(u, v), S.edgeId(u, v));
+	});
+	S.forNodes([&](node u) {
+		S.forInEdgesOf(u, [&](node u, node v, edgeid eid) {
+			ASSERT_EQ(G.edgeId(v, u), eid);
+		});
+	});
+
+	StaticGraph withoutIds(this->Ghouse);
+	EXPECT_THROW(withoutIds.edgeId(3, 1), std::runtime_error);
+}
+
+TEST_P(GraphGTest, testStaticGraphDeletedNodes) {
+	Graph G = this->Ghouse;
+	G.removeEdge(0, 2);
+	G.removeEdge(1, 0);
+	G.removeNode(0);
+	StaticGraph S(G);
+
+	ASSERT_EQ(G.numberOfNodes(), S.numberOfNodes());
+	ASSERT_FALSE(S.hasNode(0));
+	ASSERT_EQ(G.nodes(), S.nodes());
+
+	count visited = 0;
+	S.BFSfrom(1, [&](node u, count dist) {
+		ASSERT_NE(0u, u);
+		visited++;
+	});
+	ASSERT_EQ(4u, visited);
+}
+
+TEST_P(GraphGTest, testStaticGraphCopyMoveAndToGraph) {
+	StaticGraph S(this->Ghouse);
+	StaticGraph copy(S);
+	StaticGraph moved(std::move(S));
+
+	ASSERT_EQ(0u, S.numberOfNodes());
+	ASSERT_EQ(copy.numberOfEdges(), moved.numberOfEdges());
+	copy.forEdges([&](node u, node v, edgeweight ew) {
+		ASSERT_TRUE(moved.hasEdge(u, v));
+		ASSERT_EQ(ew, moved.weight(u, v));
+	});
+
+	Graph G = moved.toGraph();
+	ASSERT_EQ(this->Ghouse.isWeighted(), G.isWeighted());
+	ASSERT_EQ(this->Ghouse.isDirected(), G.isDirected());
+	ASSERT_EQ(this->Ghouse.numberOfEdges(), G.numberOfEdges());
+	this->Ghouse.forEdges([&](node u, node v, edgeweight ew) {
+		ASSERT_TRUE(G.hasEdge(u, v));
+		ASSERT_EQ(ew, G.weight(u, v));
+	});
+}
+
 } /* namespace NetworKit */
 
 #endif /*NOGTEST */
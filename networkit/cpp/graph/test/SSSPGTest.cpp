@@ -10,9 +10,15 @@
 #include "../BFS.h"
 #include "../DynDijkstra.h"
 #include "../Dijkstra.h"
+#include "../DirOptBFS.h"
+#include "../DeltaStepping.h"
+#include "../MultiSourceBFS.h"
+#include "../../generators/ErdosRenyiGenerator.h"
 #include "../../io/METISGraphReader.h"
 #include "../../auxiliary/Log.h"
+#include "../../auxiliary/Random.h"
 
+#include <algorithm>
 #include <stack>
 
 
@@ -191,4 +197,166 @@ TEST_F(SSSPGTest, testDirectedDijkstra) {
 	EXPECT_EQ(sssp.distance(6), 1);
 	EXPECT_EQ(sssp.distance(7), 3);
 }
+
+TEST_F(SSSPGTest, testDirOptBFS) {
+	METISGraphReader reader;
+	Graph G = reader.read("input/PGPgiantcompo.graph");
+	Graph D = ErdosRenyiGenerator(2000, 0.005, true).generate();
+	// remove a node so that the bottom-up steps have to skip a hole in the id range
+	auto isolateAndRemove = [](Graph& H, node u) {
+		std::vector<std::pair<node, node>> incident;
+		H.forEdgesOf(u, [&](node u, node v) { incident.emplace_back(u, v); });
+		H.forInEdgesOf(u, [&](node u, node v) { incident.emplace_back(v, u); });
+		for (auto e : incident) {
+			if (H.hasEdge(e.first, e.second)) H.removeEdge(e.first, e.second);
+		}
+		H.removeNode(u);
+	};
+	isolateAndRemove(G, 17);
+	isolateAndRemove(D, 3);
+
+	for (Graph* graph : {&G, &D}) {
+		const Graph& H = *graph;
+		for (node source : {0, 2, 1000}) {
+			BFS bfs(H, source, true, true);
+			bfs.run();
+			DirOptBFS dbfs(H, source, true, true);
+			dbfs.run();
+
+			H.forNodes([&](node v) {
+				EXPECT_EQ(bfs.distance(v), dbfs.distance(v)) << "node " << v;
+				EXPECT_EQ(bfs.numberOfPaths(v), dbfs.numberOfPaths(v)) << "node " << v;
+				auto expected = bfs.getPredecessors(v);
+				auto actual = dbfs.getPredecessors(v);
+				std::sort(expected.begin(), expected.end());
+				std::sort(actual.begin(), actual.end());
+				EXPECT_EQ(expected, actual) << "node " << v;
+			});
+
+			// the stack has to contain the reached nodes in nondecreasing distance
+			std::vector<node> stack = dbfs.getStack();
+			EXPECT_EQ(bfs.getStack().size(), stack.size());
+			for (index i = 1; i < stack.size(); ++i) {
+				EXPECT_LE(dbfs.distance(stack[i - 1]), dbfs.distance(stack[i]));
+			}
+		}
+	}
+}
+
+TEST_F(SSSPGTest, testDirOptBFSTarget) {
+	METISGraphReader reader;
+	Graph G = reader.read("input/PGPgiantcompo.graph");
+	BFS bfs(G, 0, false);
+	bfs.run();
+	node target = 5000;
+	DirOptBFS dbfs(G, 0, false, false, target);
+	dbfs.run();
+	EXPECT_EQ(bfs.distance(target), dbfs.distance(target));
+	G.forNodes([&](node v) {
+		if (bfs.distance(v) <= bfs.distance(target)) {
+			EXPECT_EQ(bfs.distance(v), dbfs.distance(v));
+		}
+	});
+}
+
+TEST_F(SSSPGTest, testDeltaStepping) {
+	Aux::Random::setSeed(42, false);
+	Graph U = ErdosRenyiGenerator(1500, 0.004).generate();
+	Graph D = ErdosRenyiGenerator(1500, 0.004, true).generate();
+	for (Graph* graph : {&U, &D}) {
+		Graph G(*graph, true, graph->isDirected());
+		G.forEdges([&](node u, node v) {
+			// integral weights produce ties, so the path counts are checked as well
+			G.setWeight(u, v, Aux::Random::integer(1, 10));
+		});
+
+		for (edgeweight delta : {0.0, 0.5, 3.0, 100.0}) {
+			Dijkstra dijkstra(G, 0, true, true);
+			dijkstra.run();
+			DeltaStepping deltaStepping(G, 0, true, true, none, delta);
+			deltaStepping.run();
+			EXPECT_GT(deltaStepping.getDelta(), 0);
+
+			G.forNodes([&](node v) {
+				EXPECT_EQ(dijkstra.distance(v), deltaStepping.distance(v)) << "node " << v << ", delta " << delta;
+				EXPECT_EQ(dijkstra.numberOfPaths(v), deltaStepping.numberOfPaths(v)) << "node " << v;
+				if (dijkstra.distance(v) == std::numeric_limits<edgeweight>::max()) {
+					return; // Dijkstra also links unreachable nodes among each other
+				}
+				auto expected = dijkstra.getPredecessors(v);
+				auto actual = deltaStepping.getPredecessors(v);
+				std::sort(expected.begin(), expected.end());
+				std::sort(actual.begin(), actual.end());
+				EXPECT_EQ(expected, actual) << "node " << v;
+			});
+
+			std::vector<node> stack = deltaStepping.getStack();
+			for (index i = 1; i < stack.size(); ++i) {
+				EXPECT_LE(deltaStepping.distance(stack[i - 1]), deltaStepping.distance(stack[i]));
+			}
+		}
+
+		DeltaStepping early(G, 0, false, false, 42);
+		early.run();
+		Dijkstra dijkstra(G, 0, false);
+		dijkstra.run();
+		EXPECT_EQ(dijkstra.distance(42), early.distance(42));
+	}
+}
+
+TEST_F(SSSPGTest, testDeltaSteppingZeroWeights) {
+	Aux::Random::setSeed(42, false);
+	Graph G(ErdosRenyiGenerator(500, 0.01).generate(), true, false);
+	G.forEdges([&](node u, node v) {
+		G.setWeight(u, v, Aux::Random::integer(0, 3));
+	});
+
+	DeltaStepping withPaths(G, 0, true, false);
+	EXPECT_THROW(withPaths.run(), std::runtime_error);
+	DeltaStepping withStack(G, 0, false, true);
+	EXPECT_THROW(withStack.run(), std::runtime_error);
+
+	DeltaStepping deltaStepping(G, 0, false, false);
+	deltaStepping.run();
+	Dijkstra dijkstra(G, 0, false);
+	dijkstra.run();
+	G.forNodes([&](node v) {
+		EXPECT_EQ(dijkstra.distance(v), deltaStepping.distance(v)) << "node " << v;
+	});
+}
+
+TEST_F(SSSPGTest, testMultiSourceBFS) {
+	Aux::Random::setSeed(42, false);
+	Graph U = ErdosRenyiGenerator(1000, 0.003).generate();
+	Graph D = ErdosRenyiGenerator(1000, 0.004, true).generate();
+	for (Graph* graph : {&U, &D}) {
+		const Graph& G = *graph;
+		// a full batch including a duplicate source, and a partial one
+		std::vector<node> sources;
+		for (node s = 0; s < 63; ++s) {
+			sources.push_back(3 * s);
+		}
+		sources.push_back(3);
+		std::vector<std::vector<node>> batches = {sources, {7, 500, 999}};
+
+		MultiSourceBFS msbfs(G);
+		for (auto& batch : batches) {
+			std::vector<std::vector<edgeweight>> dist(batch.size(), std::vector<edgeweight>(G.upperNodeIdBound(), std::numeric_limits<edgeweight>::max()));
+			count lastDist = 0;
+			msbfs.run(batch, [&](node v, count d, uint64_t newSources) {
+				EXPECT_LE(lastDist, d);
+				lastDist = d;
+				MultiSourceBFS::forSources(newSources, [&](index i) {
+					EXPECT_EQ(std::numeric_limits<edgeweight>::max(), dist[i][v]);
+					dist[i][v] = d;
+				});
+			});
+			for (index i = 0; i < batch.size(); ++i) {
+				BFS bfs(G, batch[i], false);
+				bfs.run();
+				EXPECT_EQ(bfs.getDistances(), dist[i]) << "source " << batch[i];
+			}
+		}
+	}
+}
 }
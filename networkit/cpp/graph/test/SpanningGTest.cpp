@@ -7,9 +7,17 @@
 
 #include "SpanningGTest.h"
 #include "../KruskalMSF.h"
+#include "../BoruvkaMSF.h"
+#include "../RandomMaximumSpanningForest.h"
+#include "../UnionMaximumSpanningForest.h"
 #include "../RandomSpanningForest.h"
 #include "../SpanningForest.h"
 #include "../../io/METISGraphReader.h"
+#include "../../generators/ErdosRenyiGenerator.h"
+#include "../../structures/UnionFind.h"
+#include "../../auxiliary/Random.h"
+
+#include <algorithm>
 
 namespace NetworKit {
 
@@ -69,4 +77,107 @@ TEST_F(SpanningGTest, testSpanningForest) {
 	}
 }
 
+/**
+ * Weight of a minimum (or maximum) spanning forest by a sequential Kruskal over all sorted edges.
+ */
+static double kruskalWeight(const Graph& G, bool maximum, count& forestEdges) {
+	std::vector<WeightedEdge> edges;
+	G.forEdges([&](node u, node v, edgeweight w) {
+		edges.emplace_back(u, v, w);
+	});
+	std::sort(edges.begin(), edges.end());
+	if (maximum) {
+		std::reverse(edges.begin(), edges.end());
+	}
+
+	UnionFind uf(G.upperNodeIdBound());
+	double weight = 0;
+	forestEdges = 0;
+	for (const WeightedEdge& e : edges) {
+		if (uf.find(e.u) != uf.find(e.v)) {
+			uf.merge(e.u, e.v);
+			weight += e.weight;
+			++forestEdges;
+		}
+	}
+	return weight;
+}
+
+TEST_F(SpanningGTest, testBoruvkaMSF) {
+	for (count n : {10, 50, 2000}) {
+		Graph G = ErdosRenyiGenerator(n, 3.0 / n).generate();
+		Graph W(G, true, false);
+		// few distinct weights, so that there are many ties
+		W.forEdges([&](node u, node v) {
+			W.setWeight(u, v, (double) Aux::Random::integer(1, 5));
+		});
+		W.indexEdges();
+
+		for (bool maximum : {false, true}) {
+			count expectedEdges;
+			double expected = kruskalWeight(W, maximum, expectedEdges);
+
+			for (bool randomTies : {false, true}) {
+				BoruvkaMSF msf(W, maximum, randomTies);
+				msf.run();
+				EXPECT_DOUBLE_EQ(expected, msf.totalWeight());
+				EXPECT_EQ(expectedEdges, msf.forestEdges().size());
+				EXPECT_EQ(expectedEdges, msf.forestEdgeIds().size());
+
+				for (index i = 0; i < msf.forestEdges().size(); ++i) {
+					const WeightedEdge& e = msf.forestEdges()[i];
+					EXPECT_TRUE(W.hasEdge(e.u, e.v));
+					EXPECT_EQ(W.weight(e.u, e.v), e.weight);
+					EXPECT_EQ(W.edgeId(e.u, e.v), msf.forestEdgeIds()[i]);
+				}
+
+				Graph F = msf.getForest();
+				EXPECT_EQ(expectedEdges, F.numberOfEdges());
+				EXPECT_DOUBLE_EQ(expected, F.totalEdgeWeight());
+			}
+
+			// an edge attribute gives the same forest as the same values used as edge weights
+			std::vector<double> attribute(W.upperEdgeIdBound());
+			W.forEdges([&](node u, node v, edgeweight w, edgeid eid) {
+				attribute[eid] = w;
+			});
+			BoruvkaMSF byAttribute(W, attribute, maximum);
+			byAttribute.run();
+			EXPECT_DOUBLE_EQ(expected, byAttribute.totalWeight());
+			EXPECT_EQ(expectedEdges, byAttribute.getForest().numberOfEdges());
+		}
+	}
+}
+
+TEST_F(SpanningGTest, testMaximumSpanningForests) {
+	Graph G = ErdosRenyiGenerator(1000, 0.005).generate();
+	Graph W(G, true, false);
+	W.forEdges([&](node u, node v) {
+		W.setWeight(u, v, (double) Aux::Random::integer(1, 3));
+	});
+	W.indexEdges();
+
+	count expectedEdges;
+	double expected = kruskalWeight(W, true, expectedEdges);
+
+	UnionMaximumSpanningForest umsf(W);
+	umsf.run();
+	std::vector<bool> inUnion = umsf.getAttribute();
+
+	for (index run = 0; run < 5; ++run) {
+		RandomMaximumSpanningForest rmsf(W);
+		rmsf.run();
+		Graph F = rmsf.getMSF();
+		EXPECT_EQ(expectedEdges, F.numberOfEdges());
+		EXPECT_DOUBLE_EQ(expected, F.totalEdgeWeight());
+
+		// each maximum-weight spanning forest is part of the union
+		std::vector<bool> inForest = rmsf.getAttribute();
+		W.forEdges([&](node u, node v, edgeid eid) {
+			EXPECT_EQ(inForest[eid], rmsf.inMSF(u, v));
+			EXPECT_TRUE(!inForest[eid] || inUnion[eid]);
+		});
+	}
+}
+
 } /* namespace NetworKit */
@@ -6,21 +6,29 @@
  */
 
 #include "EdgeListReader.h"
+#include "MemoryMappedFile.h"
 #include "../auxiliary/Log.h"
+#include "../auxiliary/NumberParsing.h"
+#include "../graph/GraphBuilder.h"
 
 #include <sstream>
+#include <cstring>
+#include <omp.h>
 
 #include "../auxiliary/Enforce.h"
 
 namespace NetworKit {
 
-EdgeListReader::EdgeListReader(const char separator, const node firstNode, const std::string commentPrefix, const bool continuous, const bool directed) :
-	separator(separator), commentPrefix(commentPrefix), firstNode(firstNode), continuous(continuous), mapNodeIds(), directed(directed) {
+EdgeListReader::EdgeListReader(const char separator, const node firstNode, const std::string commentPrefix, const bool continuous, const bool directed, const bool parallel) :
+	separator(separator), commentPrefix(commentPrefix), firstNode(firstNode), continuous(continuous), mapNodeIds(), directed(directed), parallel(parallel) {
 //	this->mapNodeIds;i
 }
 
 Graph EdgeListReader::read(const std::string& path) {
-	if (this->continuous) {
+	if (this->continuous && this->parallel) {
+		DEBUG("read graph with continuous ids in parallel");
+		return readContinuousParallel(path);
+	} else if (this->continuous) {
 		DEBUG("read graph with continuous ids");
 		return readContinuous(path);
 	} else {
@@ -140,6 +148,157 @@ Graph EdgeListReader::readContinuous(const std::string& path) {
 }
 
 
+namespace {
+
+struct ParsedEdge {
+	node u;
+	node v;
+	edgeweight weight;
+};
+
+/**
+ * Parses the fields of the edge line [it, end) without allocating. Returns the number of fields
+ * (2 or 3) and throws std::invalid_argument for malformed lines.
+ */
+count parseEdgeLine(const char* it, const char* end, char separator, node& u, node& v, edgeweight& weight) {
+	auto skipSeparator = [&]() {
+		if (it != end && *it == separator) {
+			++it;
+		}
+	};
+	std::tie(u, it) = Aux::Parsing::strTo<node>(it, end);
+	skipSeparator();
+	if (it == end) {
+		throw std::invalid_argument("line has only one field");
+	}
+	std::tie(v, it) = Aux::Parsing::strTo<node>(it, end);
+	skipSeparator();
+	if (it == end) {
+		return 2;
+	}
+	std::tie(weight, it) = Aux::Parsing::strTo<edgeweight>(it, end);
+	skipSeparator();
+	if (it != end) {
+		throw std::invalid_argument("line has more than three fields");
+	}
+	return 3;
+}
+
+} /* anonymous namespace */
+
+Graph EdgeListReader::readContinuousParallel(const std::string& path) {
+	MemoryMappedFile file(path);
+	const char* const fileBegin = file.cbegin();
+	const char* const fileEnd = file.cend();
+
+	// calls handle(line, lineEnd) for each non-empty, non-comment line starting in [from, to)
+	auto forLines = [&](const char* from, const char* to, std::function<bool(const char*, const char*)> handle) {
+		if (from != fileBegin && from < to && *(from - 1) != '\n') {
+			const char* newline = static_cast<const char*>(std::memchr(from, '\n', fileEnd - from));
+			from = newline ? newline + 1 : fileEnd;
+		}
+		const char* line = from;
+		while (line < to) {
+			const char* newline = static_cast<const char*>(std::memchr(line, '\n', fileEnd - line));
+			const char* lineEnd = newline ? newline : fileEnd;
+			const char* next = newline ? newline + 1 : fileEnd;
+			if (lineEnd != line && *(lineEnd - 1) == '\r') --lineEnd;
+			bool isComment = (count)(lineEnd - line) >= this->commentPrefix.length()
+				&& std::equal(this->commentPrefix.begin(), this->commentPrefix.end(), line);
+			if (lineEnd != line && !isComment) {
+				if (!handle(line, lineEnd)) return;
+			}
+			line = next;
+		}
+	};
+
+	auto malformed = [&](const char* line, const char* lineEnd) {
+		std::stringstream message;
+		message << "malformed line at byte " << (line - fileBegin) << ": " << std::string(line, lineEnd);
+		return message.str();
+	};
+
+	// the first edge line decides whether the graph is weighted
+	bool weighted = false;
+	forLines(fileBegin, fileEnd, [&](const char* line, const char* lineEnd) {
+		node u, v;
+		edgeweight ew;
+		try {
+			weighted = (parseEdgeLine(line, lineEnd, this->separator, u, v, ew) == 3);
+		} catch (std::invalid_argument&) {
+			throw std::runtime_error(malformed(line, lineEnd));
+		}
+		if (weighted) {
+			INFO("Identified graph as weighted.");
+		}
+		return false;
+	});
+
+	// parse byte ranges in parallel; the edges are bucketed by the thread that will later own their source
+	const count numberOfOwners = std::max(omp_get_max_threads(), 1);
+	const count numberOfChunks = 4 * numberOfOwners;
+	std::vector< std::vector< std::vector<ParsedEdge> > > buckets(numberOfChunks, std::vector< std::vector<ParsedEdge> >(numberOfOwners));
+	std::string error;
+	node maxNode = 0;
+
+	#pragma omp parallel for schedule(dynamic, 1) reduction(max:maxNode)
+	for (index chunk = 0; chunk < numberOfChunks; ++chunk) {
+		const char* from = fileBegin + (file.size() * chunk) / numberOfChunks;
+		const char* to = fileBegin + (file.size() * (chunk + 1)) / numberOfChunks;
+		forLines(from, to, [&](const char* line, const char* lineEnd) {
+			ParsedEdge e;
+			e.weight = defaultEdgeWeight;
+			count fields = 0;
+			try {
+				fields = parseEdgeLine(line, lineEnd, this->separator, e.u, e.v, e.weight);
+			} catch (std::invalid_argument&) {
+			}
+			if (fields == 0 || (fields == 3 && !weighted) || e.u < this->firstNode || e.v < this->firstNode) {
+				#pragma omp critical
+				{
+					if (error.empty()) error = malformed(line, lineEnd);
+				}
+				return false;
+			}
+			maxNode = std::max(maxNode, std::max(e.u, e.v));
+			e.u -= this->firstNode;
+			e.v -= this->firstNode;
+			if (!directed && e.u > e.v) {
+				std::swap(e.u, e.v);
+			}
+			buckets[chunk][e.u % numberOfOwners].push_back(e);
+			return true;
+		});
+	}
+	if (!error.empty()) {
+		throw std::runtime_error(error);
+	}
+
+	count n = maxNode - this->firstNode + 1;
+	DEBUG("max. node id found: " , n);
+	GraphBuilder builder(n, weighted, directed);
+
+	// every owner adds the half edges of its sources, keeping the first occurrence of duplicate edges
+	#pragma omp parallel for schedule(dynamic, 1)
+	for (index owner = 0; owner < numberOfOwners; ++owner) {
+		std::vector<ParsedEdge> edges;
+		for (index chunk = 0; chunk < numberOfChunks; ++chunk) {
+			edges.insert(edges.end(), buckets[chunk][owner].begin(), buckets[chunk][owner].end());
+			std::vector<ParsedEdge>().swap(buckets[chunk][owner]);
+		}
+		std::stable_sort(edges.begin(), edges.end(), [](const ParsedEdge& a, const ParsedEdge& b) {
+			return a.u < b.u || (a.u == b.u && a.v < b.v);
+		});
+		for (index i = 0; i < edges.size(); ++i) {
+			if (i > 0 && edges[i].u == edges[i - 1].u && edges[i].v == edges[i - 1].v) continue;
+			builder.addHalfEdge(edges[i].u, edges[i].v, edges[i].weight);
+		}
+	}
+
+	return builder.toGraph(true, true);
+}
+
+
 Graph EdgeListReader::readNonContinuous(const std::string& path) {
 	std::ifstream file(path);
 	Aux::enforceOpened(file);
@@ -36,8 +36,9 @@ public:
 	 * @param[in]	commentChar	character used to mark comment lines
 	 * @param[in]	continuous	boolean to specify, if node ids are continuous
 	 * @param[in]	directed	treat graph as directed
+	 * @param[in]	parallel	read files with continuous node ids in parallel (see readContinuousParallel)
 	 */
-	EdgeListReader(const char separator, const node firstNode, const std::string commentPrefix = "#", const bool continuous = true, const bool directed = false);
+	EdgeListReader(const char separator, const node firstNode, const std::string commentPrefix = "#", const bool continuous = true, const bool directed = false, const bool parallel = false);
 
 	/**
 	 * Given the path of an input file, read the graph contained.
@@ -65,10 +66,18 @@ protected:
 	bool continuous;
 	std::map<std::string,node> mapNodeIds;
 	bool directed;
+	bool parallel;
 
 private:
 	Graph readContinuous(const std::string& path);
 
+	/**
+	 * Single-pass parallel variant of readContinuous. The memory mapped file is split into byte
+	 * ranges which are parsed concurrently without allocating per line, the edges are
+	 * deduplicated per source node and the graph is assembled with GraphBuilder.
+	 */
+	Graph readContinuousParallel(const std::string& path);
+
 	Graph readNonContinuous(const std::string& path);
 
 };
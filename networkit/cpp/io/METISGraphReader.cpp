@@ -7,14 +7,26 @@
 
 #include "METISGraphReader.h"
 #include "METISParser.h"
+#include "MemoryMappedFile.h"
+#include "../auxiliary/NumberParsing.h"
 #include "../auxiliary/Enforce.h"
 #include "../auxiliary/Log.h"
 #include "../auxiliary/StringTools.h"
 #include "../graph/GraphBuilder.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstring>
+#include <functional>
+#include <omp.h>
+
 namespace NetworKit {
 
 Graph METISGraphReader::read(const std::string& path) {
+	if (parallel) {
+		return readParallel(path);
+	}
 
 	METISParser parser(path);
 
@@ -112,4 +124,162 @@ Graph METISGraphReader::read(const std::string& path) {
 	return G;
 }
 
+namespace {
+
+/**
+ * Returns the first non-whitespace position in [it, end).
+ */
+inline const char* skipSpaces(const char* it, const char* end) {
+	while (it != end && std::isspace(static_cast<unsigned char>(*it))) {
+		++it;
+	}
+	return it;
+}
+
+/**
+ * Returns the end of the line starting at @a it, i.e. the position of the next newline or @a end.
+ */
+inline const char* lineEnd(const char* it, const char* end) {
+	const char* newline = static_cast<const char*>(std::memchr(it, '\n', end - it));
+	return newline ? newline : end;
+}
+
+} /* anonymous namespace */
+
+Graph METISGraphReader::readParallel(const std::string& path) {
+	MemoryMappedFile file(path);
+	const char* const fileBegin = file.cbegin();
+	const char* const fileEnd = file.cend();
+
+	// header: first line that is not a comment
+	const char* it = fileBegin;
+	while (it != fileEnd && *it == '%') {
+		it = lineEnd(it, fileEnd);
+		if (it != fileEnd) ++it;
+	}
+	Aux::enforce(it != fileEnd, "getting METIS file header failed");
+	const char* headerEnd = lineEnd(it, fileEnd);
+	std::vector<count> tokens;
+	for (it = skipSpaces(it, headerEnd); it != headerEnd; it = skipSpaces(it, headerEnd)) {
+		count token;
+		std::tie(token, it) = Aux::Parsing::strTo<count>(it, headerEnd);
+		tokens.push_back(token);
+	}
+	Aux::enforce(tokens.size() >= 2, "getting METIS file header failed");
+	const count n = tokens[0];
+	const count m = tokens[1];
+	const index fmt = tokens.size() >= 3 ? tokens[2] : 0;
+	const count ncon = tokens.size() >= 3 ? (tokens.size() == 4 ? tokens[3] : 1) : 0;
+	if (fmt >= 2) {
+		WARN("nodes are weighted; node weights will be ignored");
+	}
+	const bool weighted = (fmt % 10 == 1);
+	const count ignoreFirst = (fmt / 10 == 1) ? ncon : 0;
+
+	// index the adjacency lines with a parallel newline scan: every chunk counts the lines
+	// starting in it, a prefix sum over the chunks gives the node of each line
+	const char* body = (headerEnd == fileEnd) ? fileEnd : headerEnd + 1;
+	const count bodySize = fileEnd - body;
+	const count numberOfChunks = 4 * std::max(omp_get_max_threads(), 1);
+	auto chunkBegin = [&](index chunk) {
+		return body + (bodySize * chunk) / numberOfChunks;
+	};
+	// a line starts in the chunk that contains its first character; comment lines do not count
+	auto forLineStarts = [&](index chunk, std::function<void(const char*)> handle) {
+		const char* from = chunkBegin(chunk);
+		const char* to = chunkBegin(chunk + 1);
+		for (const char* pos = from; pos < to; ) {
+			if (pos == body || *(pos - 1) == '\n') {
+				if (*pos != '%') handle(pos);
+			}
+			const char* newline = static_cast<const char*>(std::memchr(pos, '\n', to - pos));
+			if (!newline) break;
+			pos = newline + 1;
+		}
+	};
+
+	std::vector<count> linesPerChunk(numberOfChunks + 1, 0);
+	#pragma omp parallel for schedule(dynamic, 1)
+	for (index chunk = 0; chunk < numberOfChunks; ++chunk) {
+		count lines = 0;
+		forLineStarts(chunk, [&](const char*) { ++lines; });
+		linesPerChunk[chunk + 1] = lines;
+	}
+	for (index chunk = 0; chunk < numberOfChunks; ++chunk) {
+		linesPerChunk[chunk + 1] += linesPerChunk[chunk];
+	}
+	// a file ending with a newline has no line after it, but an empty last line may still be an isolated node
+	const count numberOfLines = std::min(linesPerChunk[numberOfChunks], n);
+	std::vector<const char*> lineStarts(numberOfLines);
+	#pragma omp parallel for schedule(dynamic, 1)
+	for (index chunk = 0; chunk < numberOfChunks; ++chunk) {
+		index line = linesPerChunk[chunk];
+		forLineStarts(chunk, [&](const char* start) {
+			if (line < numberOfLines) lineStarts[line] = start;
+			++line;
+		});
+	}
+
+	GraphBuilder b(n, weighted);
+	std::string graphName = Aux::StringTools::split(Aux::StringTools::split(path, '/').back(), '.').front();
+	b.setName(graphName);
+
+	INFO("\n[BEGIN] reading graph G(n=", n, ", m=", m, ") from METIS file in parallel: ", graphName);
+
+	// parse the adjacency lines concurrently, line u only adds half edges starting at u; exceptions must not leave the
+	// parallel region, so errors are only flagged there and reported afterwards
+	count edgeCounter = 0;
+	std::atomic<bool> invalidNodeId(false);
+	std::atomic<bool> malformedLine(false);
+	#pragma omp parallel for schedule(dynamic, 64) reduction(+:edgeCounter)
+	for (node u = 0; u < numberOfLines; ++u) {
+		const char* end = lineEnd(lineStarts[u], fileEnd);
+		try {
+			const char* pos = skipSpaces(lineStarts[u], end);
+			for (index i = 0; i < ignoreFirst && pos != end; ++i) {
+				double dummy;
+				std::tie(dummy, pos) = Aux::Parsing::strTo<double, const char*, Aux::Checkers::Enforcer>(pos, end);
+				pos = skipSpaces(pos, end);
+			}
+			while (pos != end) {
+				node v;
+				edgeweight weight = defaultEdgeWeight;
+				std::tie(v, pos) = Aux::Parsing::strTo<node, const char*, Aux::Checkers::Enforcer>(pos, end);
+				if (weighted) {
+					std::tie(weight, pos) = Aux::Parsing::strTo<double, const char*, Aux::Checkers::Enforcer>(pos, end);
+				}
+				pos = skipSpaces(pos, end);
+				++edgeCounter;
+				if (v == 0) {
+					ERROR("METIS Node ID should not be 0, edge ignored.");
+					continue;
+				}
+				if (v > n) {
+					invalidNodeId = true;
+					break;
+				}
+				--v; // METIS-indices are 1-based
+				edgeCounter += (u == v); // correct edgeCounter for selfloops
+				b.addHalfEdge(u, v, weight);
+			}
+		} catch (std::exception& e) {
+			malformedLine = true;
+		}
+	}
+	Aux::enforce(!malformedLine, "METIS file contains a malformed line");
+	Aux::enforce(!invalidNodeId, "METIS file contains a node id larger than the number of nodes");
+
+	auto G = b.toGraph(false);
+
+	if (G.numberOfEdges() != m) {
+		ERROR("METIS file ", path," is corrupted: actual number of added edges doesn't match the specifed number of edges");
+	}
+	if (edgeCounter != 2 * m) {
+		WARN("METIS file is corrupted: not every edge is listed twice");
+	}
+
+	INFO("\n[DONE]\n");
+	return G;
+}
+
 } /* namespace NetworKit */
@@ -21,7 +21,12 @@ namespace NetworKit {
 class METISGraphReader: public NetworKit::GraphReader {
 public:
 
-	METISGraphReader() = default;
+	/**
+	 * @param[in]	parallel	if set to @c true, the file is memory mapped, its line boundaries are
+	 * 							found with a parallel newline scan and the adjacency lines are parsed
+	 * 							concurrently straight into GraphBuilder half edges.
+	 */
+	METISGraphReader(bool parallel = false) : parallel(parallel) {}
 	
 	/**
 	 * Takes a file path as parameter and returns a graph file.
@@ -31,6 +36,11 @@ public:
 	 * @param[out]	the graph read from file
 	 */
 	virtual Graph read(const std::string& path) override;
+
+private:
+	bool parallel;
+
+	Graph readParallel(const std::string& path);
 };
 
 } /* namespace NetworKit */
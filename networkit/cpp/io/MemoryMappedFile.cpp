@@ -0,0 +1,47 @@
+/*
+ * MemoryMappedFile.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#include <stdexcept>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "MemoryMappedFile.h"
+
+namespace NetworKit {
+
+MemoryMappedFile::MemoryMappedFile(const std::string& path) : data(nullptr), length(0) {
+	int fd = open(path.c_str(), O_RDONLY);
+	if (fd < 0) {
+		throw std::runtime_error("cannot open file " + path);
+	}
+	struct stat st;
+	if (fstat(fd, &st) != 0) {
+		close(fd);
+		throw std::runtime_error("cannot stat file " + path);
+	}
+	length = st.st_size;
+	if (length > 0) {
+		void* mapping = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+		close(fd);
+		if (mapping == MAP_FAILED) {
+			throw std::runtime_error("cannot map file " + path);
+		}
+		data = static_cast<const char*>(mapping);
+	} else {
+		close(fd);
+	}
+}
+
+MemoryMappedFile::~MemoryMappedFile() {
+	if (data != nullptr) {
+		munmap(const_cast<char*>(data), length);
+	}
+}
+
+} /* namespace NetworKit */
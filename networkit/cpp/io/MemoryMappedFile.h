@@ -0,0 +1,54 @@
+/*
+ * MemoryMappedFile.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef MEMORYMAPPEDFILE_H_
+#define MEMORYMAPPEDFILE_H_
+
+#include <string>
+#include <cstdint>
+
+namespace NetworKit {
+
+/**
+ * @ingroup io
+ * Maps a file read-only into memory for the lifetime of the object. Readers use it to parse
+ * files in parallel (or not at all) without copying them through a stream first.
+ */
+class MemoryMappedFile {
+public:
+	/**
+	 * Maps the file @a path. Throws std::runtime_error if the file cannot be opened or mapped.
+	 */
+	explicit MemoryMappedFile(const std::string& path);
+
+	~MemoryMappedFile();
+
+	MemoryMappedFile(const MemoryMappedFile&) = delete;
+	MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+	/**
+	 * Returns a pointer to the first byte of the file, @c nullptr for an empty file.
+	 */
+	const char* cbegin() const { return data; }
+
+	/**
+	 * Returns a pointer behind the last byte of the file.
+	 */
+	const char* cend() const { return data + length; }
+
+	/**
+	 * Returns the size of the file in bytes.
+	 */
+	uint64_t size() const { return length; }
+
+private:
+	const char* data;
+	uint64_t length;
+};
+
+} /* namespace NetworKit */
+#endif /* MEMORYMAPPEDFILE_H_ */
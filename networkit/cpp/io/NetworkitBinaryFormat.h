@@ -0,0 +1,55 @@
+/*
+ * NetworkitBinaryFormat.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef NETWORKITBINARYFORMAT_H_
+#define NETWORKITBINARYFORMAT_H_
+
+#include <cstdint>
+
+namespace NetworKit {
+
+/**
+ * @ingroup io
+ * Layout of the NetworKit binary graph format written by NetworkitBinaryWriter and mapped by
+ * NetworkitBinaryReader.
+ *
+ * The file starts with this header, followed by the CSR arrays of a StaticGraph, each starting
+ * at an offset that is a multiple of 8 bytes:
+ * the node existence flags (z bytes, only if flagHasExists is set), the outgoing offsets
+ * (z + 1 uint64), targets (uint64), weights (double, only if weighted) and edge ids (uint64, only if
+ * edges are indexed) and, for directed graphs, the same four arrays for the incoming edges.
+ * All values are stored in the byte order of the writing machine, which is checked via byteOrder.
+ */
+struct NetworkitBinaryHeader {
+	char magic[8]; //!< "nkbgraph"
+	uint64_t byteOrder; //!< byteOrderMark in the byte order of the writer
+	uint64_t version; //!< format version
+	uint64_t flags; //!< combination of the flags below
+	uint64_t z; //!< upper bound of node ids
+	uint64_t n; //!< number of nodes
+	uint64_t m; //!< number of edges
+	uint64_t selfLoops; //!< number of self-loops
+	uint64_t omega; //!< upper bound of edge ids
+
+	static constexpr uint64_t byteOrderMark = 0x0102030405060708ULL;
+	static constexpr uint64_t currentVersion = 1;
+
+	static constexpr uint64_t flagDirected = 1;
+	static constexpr uint64_t flagWeighted = 2;
+	static constexpr uint64_t flagEdgeIds = 4;
+	static constexpr uint64_t flagHasExists = 8;
+};
+
+/**
+ * Rounds @a bytes up to the next multiple of 8.
+ */
+inline uint64_t nkbinAlign(uint64_t bytes) {
+	return (bytes + 7) & ~uint64_t(7);
+}
+
+} /* namespace NetworKit */
+#endif /* NETWORKITBINARYFORMAT_H_ */
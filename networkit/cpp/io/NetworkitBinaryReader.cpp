@@ -0,0 +1,107 @@
+/*
+ * NetworkitBinaryReader.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#include <cstring>
+#include <limits>
+#include <memory>
+
+#include "NetworkitBinaryReader.h"
+#include "NetworkitBinaryFormat.h"
+#include "MemoryMappedFile.h"
+#include "../auxiliary/Enforce.h"
+
+namespace NetworKit {
+
+namespace {
+
+/**
+ * Returns the array of @a length elements of type T at @a position in @a file and advances
+ * @a position to the start of the next array.
+ */
+template<typename T>
+const T* nextArray(const MemoryMappedFile& file, uint64_t& position, uint64_t length) {
+	// position never exceeds the file size, so neither check can overflow
+	Aux::enforce(position <= file.size() && length <= (file.size() - position) / sizeof(T), "binary graph file is truncated");
+	const uint64_t bytes = length * sizeof(T);
+	const T* array = reinterpret_cast<const T*>(file.cbegin() + position);
+	position += nkbinAlign(bytes);
+	return array;
+}
+
+/**
+ * Checks that the @a z + 1 @a offsets start at 0, never decrease and end at the number of entries.
+ */
+void checkOffsets(const index* offsets, uint64_t z) {
+	Aux::enforce(offsets[0] == 0, "binary graph file has corrupt offsets");
+	for (uint64_t u = 0; u < z; ++u) {
+		Aux::enforce(offsets[u] <= offsets[u + 1], "binary graph file has corrupt offsets");
+	}
+}
+
+/**
+ * Checks that the @a entries targets are node ids below @a z and that the edge ids, if present, are below @a omega.
+ */
+void checkTargets(const node* targets, const edgeid* ids, uint64_t entries, uint64_t z, uint64_t omega) {
+	for (uint64_t i = 0; i < entries; ++i) {
+		Aux::enforce(targets[i] < z, "binary graph file has an edge to a node out of range");
+		Aux::enforce(ids == nullptr || ids[i] < omega, "binary graph file has an edge id out of range");
+	}
+}
+
+} /* anonymous namespace */
+
+Graph NetworkitBinaryReader::read(const std::string& path) {
+	return readStatic(path).toGraph();
+}
+
+StaticGraph NetworkitBinaryReader::readStatic(const std::string& path) {
+	auto file = std::make_shared<MemoryMappedFile>(path);
+
+	Aux::enforce(file->size() >= sizeof(NetworkitBinaryHeader), "binary graph file is too small: " + path);
+	NetworkitBinaryHeader header;
+	std::memcpy(&header, file->cbegin(), sizeof(header));
+	Aux::enforce(std::memcmp(header.magic, "nkbgraph", 8) == 0, "not a NetworKit binary graph: " + path);
+	Aux::enforce(header.byteOrder == NetworkitBinaryHeader::byteOrderMark, "binary graph was written with a different byte order: " + path);
+	Aux::enforce(header.version == NetworkitBinaryHeader::currentVersion, "unsupported binary graph version: " + path);
+
+	const bool directed = header.flags & NetworkitBinaryHeader::flagDirected;
+	const bool weighted = header.flags & NetworkitBinaryHeader::flagWeighted;
+	const bool indexed = header.flags & NetworkitBinaryHeader::flagEdgeIds;
+	const bool hasExists = header.flags & NetworkitBinaryHeader::flagHasExists;
+
+	Aux::enforce(header.z < std::numeric_limits<uint64_t>::max() && header.n <= header.z, "binary graph file has a corrupt header: " + path);
+
+	uint64_t position = sizeof(NetworkitBinaryHeader);
+	const uint8_t* exists = hasExists ? nextArray<uint8_t>(*file, position, header.z) : nullptr;
+
+	const index* outOffsets = nextArray<index>(*file, position, header.z + 1);
+	checkOffsets(outOffsets, header.z);
+	const uint64_t outEntries = outOffsets[header.z];
+	const node* outTargets = nextArray<node>(*file, position, outEntries);
+	const edgeweight* outWeights = weighted ? nextArray<edgeweight>(*file, position, outEntries) : nullptr;
+	const edgeid* outIds = indexed ? nextArray<edgeid>(*file, position, outEntries) : nullptr;
+	checkTargets(outTargets, outIds, outEntries, header.z, header.omega);
+
+	const index* inOffsets = nullptr;
+	const node* inTargets = nullptr;
+	const edgeweight* inWeights = nullptr;
+	const edgeid* inIds = nullptr;
+	if (directed) {
+		inOffsets = nextArray<index>(*file, position, header.z + 1);
+		checkOffsets(inOffsets, header.z);
+		const uint64_t inEntries = inOffsets[header.z];
+		inTargets = nextArray<node>(*file, position, inEntries);
+		inWeights = weighted ? nextArray<edgeweight>(*file, position, inEntries) : nullptr;
+		inIds = indexed ? nextArray<edgeid>(*file, position, inEntries) : nullptr;
+		checkTargets(inTargets, inIds, inEntries, header.z, header.omega);
+	}
+
+	return StaticGraph(header.z, header.n, header.m, header.selfLoops, header.omega, directed, exists,
+		outOffsets, outTargets, outWeights, outIds, inOffsets, inTargets, inWeights, inIds, file);
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,50 @@
+/*
+ * NetworkitBinaryReader.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef NETWORKITBINARYREADER_H_
+#define NETWORKITBINARYREADER_H_
+
+#include <string>
+
+#include "GraphReader.h"
+#include "../graph/StaticGraph.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup io
+ * Reads graphs in the NetworKit binary format written by NetworkitBinaryWriter.
+ *
+ * readStatic() memory maps the file read-only and returns a StaticGraph that directly uses the
+ * mapped arrays, i.e. nothing is parsed or copied. The arrays are only validated in one linear
+ * pass, corrupt files (truncated arrays, decreasing offsets, node or edge ids out of range) are
+ * rejected with a std::runtime_error. Several processes mapping the same file share the page
+ * cache. The mapping is released when the last copy of the returned graph is destroyed.
+ */
+class NetworkitBinaryReader: public NetworKit::GraphReader {
+
+public:
+
+	NetworkitBinaryReader() = default;
+
+	/**
+	 * Maps the file @a path and returns a (dynamic) Graph copy of its content.
+	 *
+	 * @param[in]	path	input file path
+	 */
+	virtual Graph read(const std::string& path) override;
+
+	/**
+	 * Maps the file @a path and returns a read-only StaticGraph view on it without copying.
+	 *
+	 * @param[in]	path	input file path
+	 */
+	StaticGraph readStatic(const std::string& path);
+};
+
+} /* namespace NetworKit */
+#endif /* NETWORKITBINARYREADER_H_ */
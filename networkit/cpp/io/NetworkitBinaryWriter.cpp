@@ -0,0 +1,72 @@
+/*
+ * NetworkitBinaryWriter.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#include <cstring>
+
+#include "NetworkitBinaryWriter.h"
+#include "NetworkitBinaryFormat.h"
+#include "../auxiliary/Enforce.h"
+
+namespace NetworKit {
+
+void NetworkitBinaryWriter::write(const Graph& G, const std::string& path) {
+	write(StaticGraph(G), path);
+}
+
+template<typename T>
+void NetworkitBinaryWriter::writeArray(std::ofstream& file, const T* data, uint64_t length) {
+	const uint64_t bytes = length * sizeof(T);
+	if (bytes > 0) {
+		file.write(reinterpret_cast<const char*>(data), bytes);
+	}
+	const char padding[8] = {0};
+	file.write(padding, nkbinAlign(bytes) - bytes);
+}
+
+void NetworkitBinaryWriter::write(const StaticGraph& G, const std::string& path) {
+	std::ofstream file(path, std::ios::binary | std::ios::out | std::ios::trunc);
+	Aux::enforceOpened(file);
+
+	NetworkitBinaryHeader header;
+	std::memcpy(header.magic, "nkbgraph", 8);
+	header.byteOrder = NetworkitBinaryHeader::byteOrderMark;
+	header.version = NetworkitBinaryHeader::currentVersion;
+	header.flags = 0;
+	if (G.isDirected()) header.flags |= NetworkitBinaryHeader::flagDirected;
+	if (G.isWeighted()) header.flags |= NetworkitBinaryHeader::flagWeighted;
+	if (G.hasEdgeIds()) header.flags |= NetworkitBinaryHeader::flagEdgeIds;
+	if (G.exists != nullptr) header.flags |= NetworkitBinaryHeader::flagHasExists;
+	header.z = G.z;
+	header.n = G.n;
+	header.m = G.m;
+	header.selfLoops = G.storedNumberOfSelfLoops;
+	header.omega = G.omega;
+	file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+	if (G.exists != nullptr) {
+		writeArray(file, G.exists, G.z);
+	}
+
+	const uint64_t outEntries = G.outOffsets[G.z];
+	writeArray(file, G.outOffsets, G.z + 1);
+	writeArray(file, G.outTargets, outEntries);
+	if (G.isWeighted()) writeArray(file, G.outWeights, outEntries);
+	if (G.hasEdgeIds()) writeArray(file, G.outIds, outEntries);
+
+	if (G.isDirected()) {
+		const uint64_t inEntries = G.inOffsets[G.z];
+		writeArray(file, G.inOffsets, G.z + 1);
+		writeArray(file, G.inTargets, inEntries);
+		if (G.isWeighted()) writeArray(file, G.inWeights, inEntries);
+		if (G.hasEdgeIds()) writeArray(file, G.inIds, inEntries);
+	}
+
+	Aux::enforce(file.good(), "writing the binary graph failed");
+	file.close();
+}
+
+} /* namespace NetworKit */
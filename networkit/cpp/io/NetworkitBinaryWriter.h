@@ -0,0 +1,45 @@
+/*
+ * NetworkitBinaryWriter.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef NETWORKITBINARYWRITER_H_
+#define NETWORKITBINARYWRITER_H_
+
+#include <fstream>
+
+#include "GraphWriter.h"
+#include "../graph/StaticGraph.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup io
+ * Writes graphs in the NetworKit binary format (see NetworkitBinaryHeader), which can be
+ * memory mapped by NetworkitBinaryReader without parsing or copying.
+ */
+class NetworkitBinaryWriter: public NetworKit::GraphWriter {
+
+public:
+
+	NetworkitBinaryWriter() = default;
+
+	/**
+	 * Writes @a G to the file @a path. The graph is frozen into a StaticGraph first.
+	 */
+	virtual void write(const Graph& G, const std::string& path) override;
+
+	/**
+	 * Writes the static graph @a G to the file @a path.
+	 */
+	void write(const StaticGraph& G, const std::string& path);
+
+private:
+	template<typename T>
+	static void writeArray(std::ofstream& file, const T* data, uint64_t length);
+};
+
+} /* namespace NetworKit */
+#endif /* NETWORKITBINARYWRITER_H_ */
@@ -10,6 +10,7 @@
 #include <utility>
 #include <algorithm>
 #include <fstream>
+#include <omp.h>
 
 #include "IOBenchmark.h"
 #include "../RasterReader.h"
@@ -95,6 +96,26 @@ TEST_F(IOBenchmark, timeMETISGraphReader) {
 
 }
 
+TEST_F(IOBenchmark, timeMETISGraphReaderParallel) {
+	std::vector<std::string> paths = {"input/PGPgiantcompo.graph", "input/astro-ph.graph", "input/hep-th.graph"};
+	for (auto& path : paths) {
+		Aux::Timer runtime;
+
+		runtime.start();
+		Graph G = METISGraphReader().read(path);
+		runtime.stop();
+		INFO("sequential METIS reader on ", path, ": ", runtime.elapsedTag());
+
+		runtime.start();
+		Graph H = METISGraphReader(true).read(path);
+		runtime.stop();
+		INFO("parallel METIS reader on ", path, " with ", omp_get_max_threads(), " threads: ", runtime.elapsedTag());
+
+		EXPECT_EQ(G.numberOfNodes(), H.numberOfNodes());
+		EXPECT_EQ(G.numberOfEdges(), H.numberOfEdges());
+	}
+}
+
 
 TEST_F(IOBenchmark, benchRasterReader) {
 	double normalizationFactor = 0.05;
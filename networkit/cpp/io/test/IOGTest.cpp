@@ -9,7 +9,11 @@
 
 #include "IOGTest.h"
 
+#include <cstddef>
+#include <cstring>
 #include <fstream>
+#include <iterator>
+#include <limits>
 #include <unordered_set>
 #include <vector>
 
@@ -32,6 +36,9 @@
 #include "../GMLGraphReader.h"
 #include "../GraphToolBinaryReader.h"
 #include "../GraphToolBinaryWriter.h"
+#include "../NetworkitBinaryReader.h"
+#include "../NetworkitBinaryWriter.h"
+#include "../NetworkitBinaryFormat.h"
 #include "../../generators/ErdosRenyiGenerator.h"
 
 #include "../../community/GraphClusteringTools.h"
@@ -387,6 +394,48 @@ TEST_F(IOGTest, testEdgeListReader) {
 
 }
 
+TEST_F(IOGTest, testEdgeListReaderParallel) {
+	std::vector<std::tuple<std::string, char, bool> > inputs = {
+		std::make_tuple("input/LFR-generator-example/network.dat", '\t', false),
+		std::make_tuple("input/example.edgelist", '\t', false),
+		std::make_tuple("input/spaceseparated.edgelist", ' ', false),
+		std::make_tuple("input/spaceseparated_weighted.edgelist", ' ', false),
+		std::make_tuple("input/comments.edgelist", '\t', false),
+		std::make_tuple("input/comments.edgelist", '\t', true)
+	};
+
+	for (auto& input : inputs) {
+		std::string path;
+		char separator;
+		bool directed;
+		std::tie(path, separator, directed) = input;
+		EdgeListReader sequentialReader(separator, 1, "#", true, directed, false);
+		EdgeListReader parallelReader(separator, 1, "#", true, directed, true);
+		Graph G = sequentialReader.read(path);
+		Graph Gpar = parallelReader.read(path);
+
+		EXPECT_EQ(G.numberOfNodes(), Gpar.numberOfNodes()) << path;
+		EXPECT_EQ(G.numberOfEdges(), Gpar.numberOfEdges()) << path;
+		EXPECT_EQ(G.numberOfSelfLoops(), Gpar.numberOfSelfLoops()) << path;
+		EXPECT_EQ(G.isWeighted(), Gpar.isWeighted()) << path;
+		EXPECT_EQ(G.isDirected(), Gpar.isDirected()) << path;
+		G.forEdges([&](node u, node v, edgeweight ew) {
+			EXPECT_TRUE(Gpar.hasEdge(u, v)) << path;
+			EXPECT_EQ(ew, Gpar.weight(u, v)) << path;
+		});
+	}
+}
+
+TEST_F(IOGTest, testEdgeListReaderParallelMalformedLine) {
+	std::string path = "output/malformed.edgelist";
+	std::ofstream file(path);
+	file << "1 2\n2 3\n3 x\n";
+	file.close();
+
+	EdgeListReader reader(' ', 1, "#", true, false, true);
+	EXPECT_THROW(reader.read(path), std::runtime_error);
+}
+
 TEST_F(IOGTest, testEdgeListPartitionReader) {
 	EdgeListPartitionReader reader(1);
 
@@ -469,6 +518,41 @@ TEST_F(IOGTest, testMETISGraphReaderWithIsolatedNode) {
 }
 
 
+TEST_F(IOGTest, testMETISGraphReaderParallel) {
+	std::vector<std::string> paths = {"input/jazz.graph", "input/jazz2double.graph", "input/example.graph",
+		"input/lesmis.graph", "input/PGPgiantcompo.graph", "input/tiny_01.graph", "input/tiny_02.graph",
+		"input/tiny_03.graph", "input/tiny_04.graph"};
+	for (auto& path : paths) {
+		Graph expected = METISGraphReader().read(path);
+		Graph G = METISGraphReader(true).read(path);
+
+		EXPECT_EQ(expected.numberOfNodes(), G.numberOfNodes()) << path;
+		EXPECT_EQ(expected.numberOfEdges(), G.numberOfEdges()) << path;
+		EXPECT_EQ(expected.numberOfSelfLoops(), G.numberOfSelfLoops()) << path;
+		EXPECT_EQ(expected.isWeighted(), G.isWeighted()) << path;
+		EXPECT_EQ(expected.getName(), G.getName()) << path;
+		EXPECT_NEAR(expected.totalEdgeWeight(), G.totalEdgeWeight(), 1e-9) << path;
+		expected.forEdges([&](node u, node v, edgeweight w) {
+			EXPECT_TRUE(G.hasEdge(u, v)) << path << ": edge (" << u << ", " << v << ") missing";
+			EXPECT_EQ(w, G.weight(u, v)) << path;
+		});
+	}
+}
+
+
+TEST_F(IOGTest, testMETISGraphReaderParallelMalformedLine) {
+	// unweighted, weighted and with a node weight to skip
+	std::vector<std::string> contents = {"3 2\n2\n1 x\n2\n", "3 2 1\n2 1\n1 1 3 x\n2 1\n", "3 2 10\n5 2\nx 1 3\n5 2\n"};
+	for (auto& content : contents) {
+		std::string path = "output/malformed.graph";
+		std::ofstream file(path);
+		file << content;
+		file.close();
+
+		EXPECT_THROW(METISGraphReader(true).read(path), std::runtime_error) << content;
+	}
+}
+
 TEST_F(IOGTest, tryReadingLFR) {
 	std::string graphPath;
 	std::string clustPath;
@@ -720,6 +804,118 @@ TEST_F(IOGTest, testGraphToolBinaryWriterWithDeletedNodesDirected) {
 	EXPECT_EQ(G.isWeighted(),Gread.isWeighted());
 }
 
+TEST_F(IOGTest, testNetworkitBinaryWriterAndReader) {
+	METISGraphReader metisReader;
+	Graph G = metisReader.read("input/jazz.graph");
+	NetworkitBinaryWriter writer;
+	NetworkitBinaryReader reader;
+	std::string path = "output/jazz.nkbg";
+	writer.write(G, path);
+
+	StaticGraph S = reader.readStatic(path);
+	EXPECT_TRUE(S.isView());
+	EXPECT_EQ(G.numberOfNodes(), S.numberOfNodes());
+	EXPECT_EQ(G.numberOfEdges(), S.numberOfEdges());
+	EXPECT_EQ(G.isDirected(), S.isDirected());
+	EXPECT_EQ(G.isWeighted(), S.isWeighted());
+	G.forNodes([&](node u) {
+		EXPECT_EQ(G.degree(u), S.degree(u));
+	});
+	G.forEdges([&](node u, node v) {
+		EXPECT_TRUE(S.hasEdge(u, v));
+		EXPECT_TRUE(S.hasEdge(v, u));
+	});
+
+	Graph Gread = reader.read(path);
+	EXPECT_EQ(G.numberOfNodes(), Gread.numberOfNodes());
+	EXPECT_EQ(G.numberOfEdges(), Gread.numberOfEdges());
+}
+
+TEST_F(IOGTest, testNetworkitBinaryWriterAndReaderDirectedWeighted) {
+	Graph G(6, true, true);
+	G.addEdge(0, 1, 2.5);
+	G.addEdge(1, 2, 0.5);
+	G.addEdge(2, 0, 1.0);
+	G.addEdge(3, 3, 4.0);
+	G.addEdge(5, 1, 3.0);
+	G.removeNode(4);
+	G.indexEdges();
+	NetworkitBinaryWriter writer;
+	NetworkitBinaryReader reader;
+	std::string path = "output/directedWeighted.nkbg";
+	writer.write(G, path);
+
+	StaticGraph S = reader.readStatic(path);
+	StaticGraph copy = S;
+	S = StaticGraph();
+	EXPECT_EQ(G.numberOfNodes(), copy.numberOfNodes());
+	EXPECT_EQ(G.numberOfEdges(), copy.numberOfEdges());
+	EXPECT_EQ(G.numberOfSelfLoops(), copy.numberOfSelfLoops());
+	EXPECT_TRUE(copy.isDirected());
+	EXPECT_TRUE(copy.isWeighted());
+	EXPECT_TRUE(copy.hasEdgeIds());
+	EXPECT_FALSE(copy.hasNode(4));
+	G.forEdges([&](node u, node v, edgeweight ew, edgeid eid) {
+		EXPECT_EQ(ew, copy.weight(u, v));
+		EXPECT_EQ(eid, copy.edgeId(u, v));
+	});
+	G.forNodes([&](node u) {
+		EXPECT_EQ(G.degreeIn(u), copy.degreeIn(u));
+	});
+}
+
+TEST_F(IOGTest, testNetworkitBinaryReaderRejectsOtherFormats) {
+	NetworkitBinaryReader reader;
+	EXPECT_THROW(reader.readStatic("input/jazz.graph"), std::runtime_error);
+}
+
+TEST_F(IOGTest, testNetworkitBinaryReaderRejectsCorruptFiles) {
+	Graph G(4);
+	G.addEdge(0, 1);
+	G.addEdge(1, 2);
+	G.addEdge(2, 3);
+	NetworkitBinaryWriter writer;
+	NetworkitBinaryReader reader;
+	std::string path = "output/corrupt.nkbg";
+	writer.write(G, path);
+
+	std::ifstream in(path, std::ios::binary);
+	std::vector<char> original((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+	in.close();
+	NetworkitBinaryHeader header;
+	std::memcpy(&header, original.data(), sizeof(header));
+	ASSERT_EQ(4u, header.z);
+	uint64_t offsetsPosition = sizeof(header);
+	if (header.flags & NetworkitBinaryHeader::flagHasExists) {
+		offsetsPosition += nkbinAlign(header.z);
+	}
+	uint64_t targetsPosition = offsetsPosition + (header.z + 1) * sizeof(index);
+
+	// overwrites the 64 bit value at position and expects the reader to reject the file
+	auto expectRejected = [&](uint64_t position, uint64_t value) {
+		std::vector<char> content = original;
+		std::memcpy(content.data() + position, &value, sizeof(value));
+		std::ofstream out(path, std::ios::binary | std::ios::trunc);
+		out.write(content.data(), content.size());
+		out.close();
+		EXPECT_THROW(reader.readStatic(path), std::runtime_error) << "position " << position << ", value " << value;
+	};
+
+	uint64_t zPosition = offsetof(NetworkitBinaryHeader, z);
+	expectRejected(zPosition, (uint64_t(1) << 61)); // the size of the offsets overflows
+	expectRejected(zPosition, std::numeric_limits<uint64_t>::max());
+	expectRejected(offsetsPosition, 1); // offsets must start at 0
+	expectRejected(offsetsPosition + 2 * sizeof(index), 0); // offsets must not decrease
+	expectRejected(offsetsPosition + header.z * sizeof(index), std::numeric_limits<uint64_t>::max() / 4); // more entries than the file holds
+	expectRejected(targetsPosition, header.z); // target out of range
+
+	// the unmodified file is still accepted
+	std::ofstream out(path, std::ios::binary | std::ios::trunc);
+	out.write(original.data(), original.size());
+	out.close();
+	EXPECT_EQ(G.numberOfEdges(), reader.readStatic(path).numberOfEdges());
+}
+
 } /* namespace NetworKit */
 
 #endif /* NOGTEST */
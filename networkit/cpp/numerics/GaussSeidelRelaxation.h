@@ -10,6 +10,9 @@
 
 #include "Smoother.h"
 
+#include <algorithm>
+#include <numeric>
+
 namespace NetworKit {
 
 /**
@@ -51,6 +54,18 @@ public:
 	 */
 	Vector relax(const Matrix& A, const Vector& b, const count maxIterations = std::numeric_limits<count>::max()) const;
 
+	/**
+	 * Utilizes Gauss-Seidel relaxations on the systems A*X = B for all columns of the n x k block @a B at once. Each
+	 * sweep reads every row of @a A once for all columns. A column stops being relaxed once the relative residual of
+	 * its new iterate is below the tolerance, the same test as in relax. The relaxation stops when @a maxIterations is
+	 * reached or all columns stopped.
+	 * @param A The matrix.
+	 * @param B The right-hand sides as columns.
+	 * @param X[out] The initial guesses and relaxed solutions as columns.
+	 * @param maxIterations
+	 */
+	void relaxBlock(const Matrix& A, const DenseMatrix& B, DenseMatrix& X, const count maxIterations = std::numeric_limits<count>::max()) const override;
+
 };
 
 template<class Matrix>
@@ -89,6 +104,62 @@ Vector GaussSeidelRelaxation<Matrix>::relax(const Matrix& A, const Vector& b, co
 	return relax(A, b, x, maxIterations);
 }
 
+template<class Matrix>
+void GaussSeidelRelaxation<Matrix>::relaxBlock(const Matrix& A, const DenseMatrix& B, DenseMatrix& X, const count maxIterations) const {
+	const count k = B.numberOfColumns();
+	count dimension = A.numberOfColumns();
+	Vector diagonal = A.diagonal();
+
+	std::vector<double> bNorm(k, 0.0); // squared norms of the right-hand sides
+	for (index i = 0; i < dimension; ++i) {
+		for (index j = 0; j < k; ++j) {
+			bNorm[j] += B(i,j) * B(i,j);
+		}
+	}
+
+	std::vector<index> active(k);
+	std::iota(active.begin(), active.end(), 0);
+	std::vector<double> r(k);
+	std::vector<double> rNorm(k);
+
+	for (count iterations = 0; iterations < maxIterations && !active.empty(); ++iterations) {
+		std::fill(rNorm.begin(), rNorm.end(), 0.0);
+
+		for (index i = 0; i < dimension; ++i) {
+			for (index j : active) {
+				r[j] = B(i,j);
+			}
+			A.forNonZeroElementsInRow(i, [&](index column, double value) {
+				for (index j : active) {
+					r[j] -= value * X(column, j);
+				}
+			});
+
+			for (index j : active) { // x_i = (b_i - sum_{c != i} a_ic x_c) / a_ii
+				X.setValue(i, j, X(i,j) + r[j] / diagonal[i]);
+			}
+		}
+
+		for (index i = 0; i < dimension; ++i) { // residual B - A*X of the new iterate, as in relax
+			for (index j : active) {
+				r[j] = B(i,j);
+			}
+			A.forNonZeroElementsInRow(i, [&](index column, double value) {
+				for (index j : active) {
+					r[j] -= value * X(column, j);
+				}
+			});
+
+			for (index j : active) {
+				rNorm[j] += r[j] * r[j];
+			}
+		}
+
+		active.erase(std::remove_if(active.begin(), active.end(), [&](index j) {
+			return rNorm[j] <= tolerance * tolerance * bNorm[j];
+		}), active.end());
+	}
+}
 
 } /* namespace NetworKit */
 
@@ -64,6 +64,24 @@ constexpr count SETUP_MAX_AGGREGATION_STAGES = 2;
 
 constexpr count SETUP_RELAX_COARSEST_SWEEPS = 400;
 
+/**************************
+ * Smoothing              *
+ **************************/
+
+enum class LAMGSmoother {
+	GAUSS_SEIDEL, // sequential Gauss-Seidel sweeps
+	PARALLEL_GAUSS_SEIDEL // Gauss-Seidel within blocks of rows, blocks are relaxed in parallel
+};
+// smoother used during setup and solve phase unless another one is passed to Lamg
+constexpr LAMGSmoother SMOOTHER_DEFAULT = LAMGSmoother::GAUSS_SEIDEL;
+
+/**************************
+ * Solve phase            *
+ **************************/
+
+// number of right-hand sides that callers solve together in one Lamg::solveBlock
+constexpr count SOLVE_BLOCK_SIZE = 8;
+
 }
 
 
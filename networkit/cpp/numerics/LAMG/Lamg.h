@@ -14,8 +14,10 @@
 #include "MultiLevelSetup.h"
 #include "SolverLamg.h"
 #include "../GaussSeidelRelaxation.h"
+#include "../ParallelGaussSeidelRelaxation.h"
+#include "LAMGSettings.h"
 #include "../../algebraic/MatrixTools.h"
-#include "../../components/ParallelConnectedComponents.h"
+#include "../../components/AfforestConnectedComponents.h"
 #include "omp.h"
 
 namespace NetworKit {
@@ -30,7 +32,9 @@ template<class Matrix>
 class Lamg : public LinearSolver<Matrix> {
 private:
 	bool validSetup;
-	GaussSeidelRelaxation<Matrix> smoother;
+	LAMGSmoother smootherType;
+	GaussSeidelRelaxation<Matrix> gaussSeidel;
+	ParallelGaussSeidelRelaxation<Matrix> parallelGaussSeidel;
 	MultiLevelSetup<Matrix> lamgSetup;
 	Matrix laplacianMatrix;
 	std::vector<LevelHierarchy<Matrix>> compHierarchies;
@@ -46,13 +50,22 @@ private:
 
 	void initializeForOneComponent();
 
+	const Smoother<Matrix>& smoother() const {
+		if (smootherType == LAMGSmoother::PARALLEL_GAUSS_SEIDEL) {
+			return parallelGaussSeidel;
+		}
+		return gaussSeidel;
+	}
+
 public:
 	/**
 	 * Construct a solver with the given @a tolerance. The relative residual ||Ax-b||/||b|| will be less than or equal to
-	 * @a tolerance after the solver finished.
+	 * @a tolerance after the solver finished. The @a smootherType selects the smoother used in all levels of the hierarchy,
+	 * LAMGSmoother::PARALLEL_GAUSS_SEIDEL lets the solve phase of a single system use multiple threads.
 	 * @param tolerance
+	 * @param smootherType
 	 */
-	Lamg(const double tolerance = 1e-6) : LinearSolver<Matrix>(tolerance), validSetup(false), lamgSetup(smoother), numComponents(0) {}
+	Lamg(const double tolerance = 1e-6, LAMGSmoother smootherType = SMOOTHER_DEFAULT) : LinearSolver<Matrix>(tolerance), validSetup(false), smootherType(smootherType), lamgSetup(smoother()), numComponents(0) {}
 	/** Default destructor */
 	~Lamg() = default;
 
@@ -94,6 +107,20 @@ public:
 	 */
 	void parallelSolve(const std::vector<Vector>& rhs, std::vector<Vector>& results, count maxConvergenceTime = 5 * 60 * 1000, count maxIterations = std::numeric_limits<count>::max());
 
+	/**
+	 * Computes the @a results for the matrix currently setup and all right-hand sides @a rhs in one block solve.
+	 * The systems share the multigrid cycles, so the matrices of the hierarchy are read once per sweep for all
+	 * right-hand sides instead of once per system. The entries of @a results are used as initial guesses.
+	 * The maximum spent time can be specified by @a maxConvergenceTime and the maximum number of iterations can be set
+	 * by @a maxIterations.
+	 * @param rhs
+	 * @param results
+	 * @param maxConvergenceTime
+	 * @param maxIterations
+	 * @return One @ref SolverStatus per right-hand side.
+	 */
+	std::vector<SolverStatus> solveBlock(const std::vector<Vector>& rhs, std::vector<Vector>& results, count maxConvergenceTime = 5 * 60 * 1000, count maxIterations = std::numeric_limits<count>::max());
+
 };
 
 template<class Matrix>
@@ -101,7 +128,7 @@ void Lamg<Matrix>::initializeForOneComponent() {
 	compHierarchies = std::vector<LevelHierarchy<Matrix>>(1);
 	lamgSetup.setup(laplacianMatrix, compHierarchies[0]);
 	compSolvers.clear();
-	compSolvers.push_back(SolverLamg<Matrix>(compHierarchies[0], smoother));
+	compSolvers.push_back(SolverLamg<Matrix>(compHierarchies[0], smoother()));
 	validSetup = true;
 }
 
@@ -116,7 +143,7 @@ template<class Matrix>
 void Lamg<Matrix>::setup(const Matrix& laplacianMatrix) {
 	this->laplacianMatrix = laplacianMatrix;
 	Graph G = MatrixTools::matrixToGraph(laplacianMatrix);
-	ParallelConnectedComponents con(G, false);
+	AfforestConnectedComponents con(G);
 	con.run();
 	numComponents = con.numberOfComponents();
 	if (numComponents == 1) {
@@ -154,7 +181,7 @@ void Lamg<Matrix>::setup(const Matrix& laplacianMatrix) {
 			initialVectors[compIdx] = Vector(component.size());
 			rhsVectors[compIdx] = Vector(component.size());
 			lamgSetup.setup(compMatrix, compHierarchies[compIdx]);
-			compSolvers.push_back(SolverLamg<Matrix>(compHierarchies[compIdx], smoother));
+			compSolvers.push_back(SolverLamg<Matrix>(compHierarchies[compIdx], smoother()));
 			LAMGSolverStatus status;
 			status.desiredResidualReduction = this->tolerance * component.size() / G.numberOfNodes();
 			compStati[compIdx] = status;
@@ -224,7 +251,7 @@ void Lamg<Matrix>::parallelSolve(const std::vector<Vector>& rhs, std::vector<Vec
 			compSolvers.clear();
 
 			for (index i = 0; i < (index) numThreads; ++i) {
-				compSolvers.push_back(SolverLamg<Matrix>(compHierarchies[0], smoother));
+				compSolvers.push_back(SolverLamg<Matrix>(compHierarchies[0], smoother()));
 			}
 		}
 
@@ -245,6 +272,93 @@ void Lamg<Matrix>::parallelSolve(const std::vector<Vector>& rhs, std::vector<Vec
 	}
 }
 
+template<class Matrix>
+std::vector<SolverStatus> Lamg<Matrix>::solveBlock(const std::vector<Vector>& rhs, std::vector<Vector>& results, count maxConvergenceTime, count maxIterations) {
+	if (!validSetup || rhs.size() != results.size()) {
+		throw std::runtime_error("No matrix is setup or the number of right-hand sides and results differ.");
+	}
+	for (index j = 0; j < rhs.size(); ++j) {
+		if (results[j].getDimension() != laplacianMatrix.numberOfColumns() || rhs[j].getDimension() != laplacianMatrix.numberOfRows()) {
+			throw std::runtime_error("No or wrong matrix is setup for given vectors.");
+		}
+	}
+
+	const count k = rhs.size();
+	std::vector<SolverStatus> status(k);
+
+	if (numComponents == 1) {
+		std::vector<LAMGSolverStatus> stati(k);
+		for (index j = 0; j < k; ++j) {
+			stati[j].desiredResidualReduction = this->tolerance * rhs[j].length() / (laplacianMatrix * results[j] - rhs[j]).length();
+			stati[j].maxIters = maxIterations;
+			stati[j].maxConvergenceTime = maxConvergenceTime;
+		}
+
+		// pack the right-hand sides and initial guesses as columns of n x k blocks
+		DenseMatrix X(laplacianMatrix.numberOfRows(), k);
+		DenseMatrix B(laplacianMatrix.numberOfRows(), k);
+#pragma omp parallel for
+		for (index u = 0; u < laplacianMatrix.numberOfRows(); ++u) {
+			for (index j = 0; j < k; ++j) {
+				X.setValue(u, j, results[j][u]);
+				B.setValue(u, j, rhs[j][u]);
+			}
+		}
+
+		compSolvers[0].solve(X, B, stati);
+
+#pragma omp parallel for
+		for (index u = 0; u < laplacianMatrix.numberOfRows(); ++u) {
+			for (index j = 0; j < k; ++j) {
+				results[j][u] = X(u, j);
+			}
+		}
+
+		for (index j = 0; j < k; ++j) {
+			status[j].residual = stati[j].residual;
+			status[j].numIters = stati[j].numIters;
+			status[j].converged = stati[j].converged;
+		}
+	} else {
+		// solve the block on every component
+		for (index i = 0; i < components.size(); ++i) {
+			const Matrix& compMatrix = compHierarchies[i].at(0).getLaplacian();
+			DenseMatrix X(components[i].size(), k);
+			DenseMatrix B(components[i].size(), k);
+			std::vector<LAMGSolverStatus> stati(k);
+			for (index j = 0; j < k; ++j) {
+				for (auto element : components[i]) {
+					initialVectors[i][graph2Components[element]] = results[j][element];
+					rhsVectors[i][graph2Components[element]] = rhs[j][element];
+					X.setValue(graph2Components[element], j, results[j][element]);
+					B.setValue(graph2Components[element], j, rhs[j][element]);
+				}
+
+				double resReduction = this->tolerance * rhsVectors[i].length() / (compMatrix * initialVectors[i] - rhsVectors[i]).length();
+				stati[j].desiredResidualReduction = resReduction * components[i].size() / laplacianMatrix.numberOfRows();
+				stati[j].maxIters = maxIterations;
+				stati[j].maxConvergenceTime = maxConvergenceTime;
+			}
+			compSolvers[i].solve(X, B, stati);
+
+			for (index j = 0; j < k; ++j) {
+				for (auto element : components[i]) { // write solution back to result
+					results[j][element] = X(graph2Components[element], j);
+				}
+
+				status[j].numIters = std::max(status[j].numIters, stati[j].numIters);
+			}
+		}
+
+		for (index j = 0; j < k; ++j) {
+			status[j].residual = (rhs[j] - laplacianMatrix * results[j]).length();
+			status[j].converged = status[j].residual <= this->tolerance;
+		}
+	}
+
+	return status;
+}
+
 } /* namespace NetworKit */
 
 #endif /* NETWORKIT_CPP_NUMERICS_LAMG_LAMG_H_ */
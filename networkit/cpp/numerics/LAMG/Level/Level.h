@@ -9,6 +9,7 @@
 #define LEVEL_H_
 
 #include "../../../algebraic/CSRMatrix.h"
+#include "../../../algebraic/DenseMatrix.h"
 
 namespace NetworKit {
 
@@ -28,6 +29,23 @@ protected:
 	LevelType type;
 	Matrix A;
 
+	/**
+	 * @return The product of the sparse matrix @a M with the n x k block @a X, computed in one pass over the rows of @a M.
+	 */
+	static DenseMatrix multiply(const Matrix& M, const DenseMatrix& X) {
+		const count k = X.numberOfColumns();
+		DenseMatrix result(M.numberOfRows(), k);
+#pragma omp parallel for
+		for (index i = 0; i < M.numberOfRows(); ++i) {
+			M.forNonZeroElementsInRow(i, [&](index column, double value) {
+				for (index j = 0; j < k; ++j) {
+					result.setValue(i, j, result(i,j) + value * X(column, j));
+				}
+			});
+		}
+		return result;
+	}
+
 public:
 	Level(LevelType type) : type(type) {}
 	Level(LevelType type, const Matrix& A) : type(type), A(A) {}
@@ -50,6 +68,21 @@ public:
 	virtual void interpolate(const Vector& xc, Vector& xf) const {}
 
 	virtual void interpolate(const Vector& xc, Vector& xf, const std::vector<Vector>& bStages) const {}
+
+	/*
+	 * Block versions of the transfer operations above. They apply the operation to all columns of the n x k blocks
+	 * at once and read the transfer matrices once.
+	 */
+
+	virtual void coarseType(const DenseMatrix& xf, DenseMatrix& xc) const {}
+
+	virtual void restrict(const DenseMatrix& bf, DenseMatrix& bc) const {}
+
+	virtual void restrict(const DenseMatrix& bf, DenseMatrix& bc, std::vector<DenseMatrix>& bStages) const {}
+
+	virtual void interpolate(const DenseMatrix& xc, DenseMatrix& xf) const {}
+
+	virtual void interpolate(const DenseMatrix& xc, DenseMatrix& xf, const std::vector<DenseMatrix>& bStages) const {}
 };
 
 
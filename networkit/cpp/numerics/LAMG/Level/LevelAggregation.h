@@ -29,6 +29,12 @@ public:
 	void restrict(const Vector& bf, Vector& bc) const;
 
 	void interpolate(const Vector& xc, Vector& xf) const;
+
+	void coarseType(const DenseMatrix& xf, DenseMatrix& xc) const;
+
+	void restrict(const DenseMatrix& bf, DenseMatrix& bc) const;
+
+	void interpolate(const DenseMatrix& xc, DenseMatrix& xf) const;
 };
 
 template<class Matrix>
@@ -46,6 +52,21 @@ void LevelAggregation<Matrix>::interpolate(const Vector& xc, Vector& xf) const {
 	xf = P * xc;
 }
 
+template<class Matrix>
+void LevelAggregation<Matrix>::coarseType(const DenseMatrix& xf, DenseMatrix& xc) const {
+	xc = DenseMatrix(P.numberOfColumns(), xf.numberOfColumns());
+}
+
+template<class Matrix>
+void LevelAggregation<Matrix>::restrict(const DenseMatrix& bf, DenseMatrix& bc) const {
+	bc = this->multiply(R, bf);
+}
+
+template<class Matrix>
+void LevelAggregation<Matrix>::interpolate(const DenseMatrix& xc, DenseMatrix& xf) const {
+	xf = this->multiply(P, xc);
+}
+
 } /* namespace NetworKit */
 
 #endif /* LEVELAGGREGATION_H_ */
@@ -30,6 +30,10 @@ public:
 	void coarseType(const Vector& xf, Vector& xc) const;
 	void restrict(const Vector& bf, Vector& bc, std::vector<Vector>& bStages) const;
 	void interpolate(const Vector& xc, Vector& xf, const std::vector<Vector>& bStages) const;
+
+	void coarseType(const DenseMatrix& xf, DenseMatrix& xc) const;
+	void restrict(const DenseMatrix& bf, DenseMatrix& bc, std::vector<DenseMatrix>& bStages) const;
+	void interpolate(const DenseMatrix& xc, DenseMatrix& xf, const std::vector<DenseMatrix>& bStages) const;
 };
 
 template<class Matrix>
@@ -110,6 +114,83 @@ void LevelElimination<Matrix>::interpolate(const Vector& xc, Vector& xf, const s
 	}
 }
 
+template<class Matrix>
+void LevelElimination<Matrix>::coarseType(const DenseMatrix& xf, DenseMatrix& xc) const {
+	const count k = xf.numberOfColumns();
+	xc = DenseMatrix(this->A.numberOfRows(), k);
+#pragma omp parallel for
+	for (index i = 0; i < xc.numberOfRows(); ++i) {
+		for (index j = 0; j < k; ++j) {
+			xc.setValue(i, j, xf(cIndexFine[i], j));
+		}
+	}
+}
+
+template<class Matrix>
+void LevelElimination<Matrix>::restrict(const DenseMatrix& bf, DenseMatrix& bc, std::vector<DenseMatrix>& bStages) const {
+	const count k = bf.numberOfColumns();
+	bStages.resize(coarseningStages.size() + 1);
+	bStages[0] = bf;
+	bc = bf;
+	index curStage = 0;
+	for (const EliminationStage<Matrix>& s : coarseningStages) {
+		const DenseMatrix& b = bStages[curStage];
+		const std::vector<index> &fSet = s.getFSet();
+		const std::vector<index> &cSet = s.getCSet();
+		bc = DenseMatrix(cSet.size(), k);
+
+#pragma omp parallel for
+		for (index i = 0; i < cSet.size(); ++i) { // b = b.c + s.P^T * b.f
+			for (index j = 0; j < k; ++j) {
+				bc.setValue(i, j, b(cSet[i], j));
+			}
+			s.getR().forNonZeroElementsInRow(i, [&](index column, double value) {
+				for (index j = 0; j < k; ++j) {
+					bc.setValue(i, j, bc(i,j) + value * b(fSet[column], j));
+				}
+			});
+		}
+
+		bStages[curStage+1] = bc;
+		curStage++;
+	}
+}
+
+template<class Matrix>
+void LevelElimination<Matrix>::interpolate(const DenseMatrix& xc, DenseMatrix& xf, const std::vector<DenseMatrix>& bStages) const {
+	const count k = xc.numberOfColumns();
+	DenseMatrix currX = xc;
+	for (index stage = coarseningStages.size(); stage-- > 0;) {
+		const EliminationStage<Matrix>& s = coarseningStages[stage];
+		const DenseMatrix& b = bStages[stage];
+		const Vector &q = s.getQ();
+		const std::vector<index> &fSet = s.getFSet();
+		const std::vector<index> &cSet = s.getCSet();
+		xf = DenseMatrix(s.getN(), k);
+
+#pragma omp parallel for
+		for (index i = 0; i < fSet.size(); ++i) { // x.f = s.P * x.c + s.q .* b.f
+			for (index j = 0; j < k; ++j) {
+				xf.setValue(fSet[i], j, q[i] * b(fSet[i], j));
+			}
+			s.getP().forNonZeroElementsInRow(i, [&](index column, double value) {
+				for (index j = 0; j < k; ++j) {
+					xf.setValue(fSet[i], j, xf(fSet[i], j) + value * currX(column, j));
+				}
+			});
+		}
+
+#pragma omp parallel for
+		for (index i = 0; i < cSet.size(); ++i) {
+			for (index j = 0; j < k; ++j) {
+				xf.setValue(cSet[i], j, currX(i, j));
+			}
+		}
+
+		currX = xf;
+	}
+}
+
 template<class Matrix>
 void LevelElimination<Matrix>::subVectorExtract(Vector& subVector, const Vector& vector, const std::vector<index>& elements) const {
 	subVector = Vector(elements.size());
@@ -103,30 +103,6 @@ void MultiLevelSetup<CSRMatrix>::computeAffinityMatrix(const CSRMatrix& matrix,
 	affinityMatrix = CSRMatrix(matrix.numberOfRows(), matrix.numberOfColumns(), rowIdx, columnIdx, nonZeros, 0.0, matrix.sorted());
 }
 
-template<>
-void MultiLevelSetup<CSRMatrix>::galerkinOperator(const CSRMatrix& P, const CSRMatrix& A, const std::vector<index>& PColIndex, const std::vector<std::vector<index>>& PRowIndex, CSRMatrix& B) const {
-	std::vector<Triplet> triplets;
-	SparseAccumulator spa(P.numberOfColumns());
-	for (index i = 0; i < P.numberOfColumns(); ++i) {
-		for (index k : PRowIndex[i]) {
-			double Pki = P(k,i);
-			A.forNonZeroElementsInRow(k, [&](index l, double value) {
-				index j = PColIndex[l];
-				spa.scatter(Pki * value * P(l, j), j);
-			});
-		}
-
-		spa.gather([&](index i, index j, double value) {
-			triplets.push_back({i,j,value});
-		});
-
-		spa.increaseRow();
-	}
-
-	B = CSRMatrix(P.numberOfColumns(), P.numberOfColumns(), triplets, 0.0, true);
-}
-
-
 template<>
 void MultiLevelSetup<CSRMatrix>::eliminationOperators(const CSRMatrix& matrix, const std::vector<index>& fSet, const std::vector<index>& coarseIndex, CSRMatrix& P, Vector& q) const {
 	std::vector<Triplet> triples;
@@ -225,21 +201,17 @@ void MultiLevelSetup<CSRMatrix>::coarseningAggregation(CSRMatrix& matrix, LevelH
 	// create interpolation matrix
 	std::vector<Triplet> pTriples(matrix.numberOfRows());
 	std::vector<Triplet> rTriples(matrix.numberOfRows());
-	std::vector<index> PColIndex(matrix.numberOfRows());
-	std::vector<std::vector<index>> PRowIndex(nc[bestAggregate]);
 
 	for (index i = 0; i < matrix.numberOfRows(); ++i) {
 		pTriples[i] = {i, status[i], 1};
 		rTriples[i] = {status[i], i, 1};
-		PColIndex[i] = status[i];
-		PRowIndex[status[i]].push_back(i);
 	}
 
 	CSRMatrix P(matrix.numberOfRows(), nc[bestAggregate], pTriples, 0.0, matrix.sorted());
 	CSRMatrix R(nc[bestAggregate], matrix.numberOfRows(), rTriples, 0.0, matrix.sorted());
 
 	// create coarsened laplacian
-	galerkinOperator(P, matrix, PColIndex, PRowIndex, matrix);
+	galerkinOperator(P, R, matrix, matrix);
 
 	hierarchy.addAggregationLevel(matrix, P, R);
 }
@@ -163,14 +163,14 @@ private:
 	bool isRelaxationFast(const Matrix& A, index lvlIndex, Vector& tv) const;
 
 	/**
-	 * Computes the coarsened matrix of @a matrix by means of the projection matrix @a P and stores the result in @a B.
+	 * Computes the coarsened matrix R * A * P of @a A by means of the projection matrix @a P and the restriction matrix
+	 * @a R and stores the result in @a B.
 	 * @param P Projection matrix.
+	 * @param R Restriction matrix, the transpose of @a P.
 	 * @param A Laplacian matrix.
-	 * @param PColIndex Stores the column index of the 1 entry at each row.
-	 * @param PRowIndex Stores the row index of the 1 entry at each column.
 	 * @param B[out] Resulting coarsened Laplacian matrix.
 	 */
-	void galerkinOperator(const Matrix& P, const Matrix& A, const std::vector<index>& PColIndex, const std::vector<std::vector<index>>& PRowIndex, Matrix& B) const;
+	void galerkinOperator(const Matrix& P, const Matrix& R, const Matrix& A, Matrix& B) const;
 
 	/**
 	 * Creates a @a hierarchy for the given Laplacian matrix @a matrix.
@@ -431,21 +431,17 @@ void MultiLevelSetup<Matrix>::coarseningAggregation(Matrix& matrix, LevelHierarc
 	// create interpolation matrix
 	std::vector<Triplet> pTriples(matrix.numberOfRows());
 	std::vector<Triplet> rTriples(matrix.numberOfRows());
-	std::vector<index> PColIndex(matrix.numberOfRows());
-	std::vector<std::vector<index>> PRowIndex(nc[bestAggregate]);
 
 	for (index i = 0; i < matrix.numberOfRows(); ++i) {
 		pTriples[i] = {i, status[i], 1};
 		rTriples[i] = {status[i], i, 1};
-		PColIndex[i] = status[i];
-		PRowIndex[status[i]].push_back(i);
 	}
 
 	Matrix P(matrix.numberOfRows(), nc[bestAggregate], pTriples);
 	Matrix R(nc[bestAggregate], matrix.numberOfRows(), rTriples);
 
 	// create coarsened laplacian
-	galerkinOperator(P, matrix, PColIndex, PRowIndex, matrix);
+	galerkinOperator(P, R, matrix, matrix);
 
 	hierarchy.addAggregationLevel(matrix, P, R);
 }
@@ -758,26 +754,8 @@ bool MultiLevelSetup<Matrix>::isRelaxationFast(const Matrix& A, index lvlIndex,
 
 
 template<class Matrix>
-void MultiLevelSetup<Matrix>::galerkinOperator(const Matrix& P, const Matrix& A, const std::vector<index>& PColIndex, const std::vector<std::vector<index>>& PRowIndex, Matrix& B) const {
-	std::vector<Triplet> triplets;
-	SparseAccumulator spa(P.numberOfColumns());
-	for (index i = 0; i < P.numberOfColumns(); ++i) {
-		for (index k : PRowIndex[i]) {
-			double Pki = P(k,i);
-			A.forNonZeroElementsInRow(k, [&](index l, double value) {
-				index j = PColIndex[l];
-				spa.scatter(Pki * value * P(l, j), j);
-			});
-		}
-
-		spa.gather([&](index i, index j, double value) {
-			triplets.push_back({i,j,value});
-		});
-
-		spa.increaseRow();
-	}
-
-	B = CSRMatrix(P.numberOfColumns(), P.numberOfColumns(), triplets);
+void MultiLevelSetup<Matrix>::galerkinOperator(const Matrix& P, const Matrix& R, const Matrix& A, Matrix& B) const {
+	B = R * (A * P);
 }
 
 } /* namespace NetworKit */
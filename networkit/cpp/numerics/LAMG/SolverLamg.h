@@ -12,6 +12,10 @@
 #include "../Smoother.h"
 #include "../../algebraic/DenseMatrix.h"
 
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
 namespace NetworKit {
 
 /**
@@ -42,21 +46,26 @@ private:
 	LevelHierarchy<Matrix> &hierarchy;
 	const Smoother<Matrix> &smoother;
 
-	// data structures for iterate recombination
-	std::vector<std::vector<Vector>> history;
-	std::vector<std::vector<Vector>> rHistory;
+	// data structures for iterate recombination, indexed by level and iterate. The columns of the n x k blocks are
+	// the systems that are not done yet
+	std::vector<std::vector<DenseMatrix>> history;
+	std::vector<std::vector<DenseMatrix>> rHistory;
 	std::vector<index> latestIterate;
 	std::vector<count> numActiveIterates;
 
-	// bStages for Elimination Levels
-	std::vector<std::vector<Vector>> bStages;
+	// bStages for Elimination Levels, indexed by level
+	std::vector<std::vector<DenseMatrix>> bStages;
 
-	void solveCycle(Vector& x, const Vector& b, int finest, LAMGSolverStatus& status);
-	void cycle(Vector& x, const Vector& b, int finest, int coarsest, std::vector<count>& numVisits, std::vector<Vector>& X, std::vector<Vector>& B, const LAMGSolverStatus& status);
-	void multigridCycle(index level, Vector& xf, const Vector& bf);
-	void saveIterate(index level, const Vector& x, const Vector& r);
+	void solveCycle(DenseMatrix& x, const DenseMatrix& b, int finest, std::vector<LAMGSolverStatus>& status);
+	void cycle(DenseMatrix& x, const DenseMatrix& b, int finest, int coarsest, std::vector<count>& numVisits, std::vector<DenseMatrix>& X, std::vector<DenseMatrix>& B, count numPreSmoothIters, count numPostSmoothIters);
+	void residual(index level, const DenseMatrix& x, const DenseMatrix& b, DenseMatrix& r) const;
+	void saveIterate(index level, const DenseMatrix& x, const DenseMatrix& r);
 	void clearHistory(index level);
-	void minRes(index level, Vector& x, const Vector& r);
+	void minRes(index level, DenseMatrix& x, const DenseMatrix& r);
+	void minRes(index level, index column, DenseMatrix& x, const DenseMatrix& r);
+
+	static std::vector<double> columnLengths(const DenseMatrix& matrix);
+	static DenseMatrix selectColumns(const DenseMatrix& matrix, const std::vector<index>& columns);
 
 public:
 	/**
@@ -65,7 +74,7 @@ public:
 	 * @param hierarchy Reference to the LevelHierarchy constructed by MultiLevelSetup.
 	 * @param smoother Reference to a smoother.
 	 */
-	SolverLamg(LevelHierarchy<Matrix>& hierarchy, const Smoother<Matrix>& smoother) : hierarchy(hierarchy), smoother(smoother), bStages(hierarchy.size(), std::vector<Vector>()) {}
+	SolverLamg(LevelHierarchy<Matrix>& hierarchy, const Smoother<Matrix>& smoother) : hierarchy(hierarchy), smoother(smoother) {}
 
 	SolverLamg (const SolverLamg<Matrix>& other) = default;
 
@@ -86,20 +95,48 @@ public:
 	 * @param status Reference to an LAMGSolverStatus.
 	 */
 	void solve(Vector& x, const Vector& b, LAMGSolverStatus& status);
+
+	/**
+	 * Solves the systems A*X = B for all columns of the n x k block @a b together. All systems run through the same
+	 * cycles, so each sweep of the smoother, each residual computation and each transfer between the levels reads
+	 * the level matrices once for all columns. A column leaves the cycles once it converged or reached its limits in
+	 * @a status, the remaining columns continue as a smaller block.
+	 * @param x[out] The initial guesses as columns, replaced by the approximate solutions.
+	 * @param b The right-hand sides as columns.
+	 * @param status One LAMGSolverStatus per column.
+	 */
+	void solve(DenseMatrix& x, const DenseMatrix& b, std::vector<LAMGSolverStatus>& status);
 };
 
 template<class Matrix>
 void SolverLamg<Matrix>::solve(Vector& x, const Vector& b, LAMGSolverStatus& status) {
-	bStages = std::vector<std::vector<Vector>>(hierarchy.size(), std::vector<Vector>());
+	DenseMatrix X(x.getDimension(), 1, 0.0);
+	DenseMatrix B(b.getDimension(), 1, 0.0);
+	for (index i = 0; i < b.getDimension(); ++i) {
+		X.setValue(i, 0, x[i]);
+		B.setValue(i, 0, b[i]);
+	}
+
+	std::vector<LAMGSolverStatus> stati = {std::move(status)};
+	solve(X, B, stati);
+	for (index i = 0; i < x.getDimension(); ++i) {
+		x[i] = X(i, 0);
+	}
+	status = std::move(stati[0]);
+}
+
+template<class Matrix>
+void SolverLamg<Matrix>::solve(DenseMatrix& x, const DenseMatrix& b, std::vector<LAMGSolverStatus>& status) {
+	bStages = std::vector<std::vector<DenseMatrix>>(hierarchy.size());
 	if (hierarchy.size() >= 2) {
-		Vector bc = b;
-		Vector xc = x;
+		DenseMatrix bc = b;
+		DenseMatrix xc = x;
 		int finest = 0;
 
 		if (hierarchy.getType(1) == ELIMINATION) {
 			hierarchy.at(1).restrict(b, bc, bStages[1]);
 			if (hierarchy.at(1).getLaplacian().numberOfRows() == 1) {
-				x = 0.0;
+				x = DenseMatrix(x.numberOfRows(), x.numberOfColumns());
 				return;
 			} else {
 				hierarchy.at(1).coarseType(x, xc);
@@ -111,67 +148,118 @@ void SolverLamg<Matrix>::solve(Vector& x, const Vector& b, LAMGSolverStatus& sta
 		if (finest == 1) { // interpolate from finest == ELIMINATION level back to actual finest level
 			hierarchy.at(1).interpolate(xc, x, bStages[1]);
 		} else {
-			x = xc;
+			x = std::move(xc);
 		}
 	} else {
 		solveCycle(x, b, 0, status);
 	}
 
-	double residual = (b - hierarchy.at(0).getLaplacian() * x).length();
-	status.residual = residual;
+	DenseMatrix r;
+	residual(0, x, b, r);
+	std::vector<double> residuals = columnLengths(r);
+	for (index j = 0; j < residuals.size(); ++j) {
+		status[j].residual = residuals[j];
+	}
 }
 
 template<class Matrix>
-void SolverLamg<Matrix>::solveCycle(Vector& x, const Vector& b, int finest, LAMGSolverStatus& status) {
+void SolverLamg<Matrix>::solveCycle(DenseMatrix& x, const DenseMatrix& b, int finest, std::vector<LAMGSolverStatus>& status) {
 	Aux::Timer timer;
 	timer.start();
+	const count k = b.numberOfColumns();
 
 	// data structures for iterate recombination
-	history = std::vector<std::vector<Vector>>(hierarchy.size());
-	rHistory = std::vector<std::vector<Vector>>(hierarchy.size());
+	history = std::vector<std::vector<DenseMatrix>>(hierarchy.size(), std::vector<DenseMatrix>(MAX_COMBINED_ITERATES));
+	rHistory = std::vector<std::vector<DenseMatrix>>(hierarchy.size(), std::vector<DenseMatrix>(MAX_COMBINED_ITERATES));
 	latestIterate = std::vector<index>(hierarchy.size(), 0);
 	numActiveIterates = std::vector<count>(hierarchy.size(), 0);
 	int coarsest = hierarchy.size() - 1;
 	std::vector<count> numVisits(coarsest);
-	std::vector<Vector> X(hierarchy.size());
-	std::vector<Vector> B(hierarchy.size());
-
-	for (index i = 0; i < hierarchy.size(); ++i) {
-		history[i] = std::vector<Vector>(MAX_COMBINED_ITERATES, Vector(hierarchy.at(i).getNumberOfNodes()));
-		rHistory[i] = std::vector<Vector>(MAX_COMBINED_ITERATES, Vector(hierarchy.at(i).getNumberOfNodes()));
+	std::vector<DenseMatrix> X(hierarchy.size());
+	std::vector<DenseMatrix> B(hierarchy.size());
+
+	DenseMatrix r;
+	residual(finest, x, b, r);
+	std::vector<double> residuals = columnLengths(r);
+	std::vector<double> finalResidual(k);
+	std::vector<double> bestResidual(k, std::numeric_limits<double>::max());
+	std::vector<count> noResReduction(k, 0);
+	for (index j = 0; j < k; ++j) {
+		finalResidual[j] = residuals[j] * status[j].desiredResidualReduction;
+		status[j].residualHistory.emplace_back(residuals[j]);
 	}
 
-	Vector r = b - hierarchy.at(finest).getLaplacian() * x;
-	double residual = r.length();
-	double finalResidual = residual * status.desiredResidualReduction;
-	double bestResidual = std::numeric_limits<double>::max();
+	// the systems that are not done yet, xActive and bActive hold their columns
+	std::vector<index> active(k);
+	std::iota(active.begin(), active.end(), 0);
+	DenseMatrix xActive = x;
+	DenseMatrix bActive = b;
 
 	count iterations = 0;
-	status.residualHistory.emplace_back(residual);
-	count noResReduction = 0;
-	while (residual > finalResidual && noResReduction < 5 && iterations < status.maxIters && timer.elapsedMilliseconds() <= status.maxConvergenceTime ) {
-		cycle(x, b, finest, coarsest, numVisits, X, B, status);
-		r = b - hierarchy.at(finest).getLaplacian() * x;
-		residual = r.length();
-		status.residualHistory.emplace_back(residual);
-		if (residual < bestResidual) {
-			noResReduction = 0;
-			bestResidual = residual;
-		} else {
-			++noResReduction;
+	while (true) {
+		// a system is done once it converged, stagnated or ran out of iterations or time
+		std::vector<index> remaining;
+		std::vector<index> remainingColumns;
+		for (index c = 0; c < active.size(); ++c) {
+			index j = active[c];
+			if (residuals[j] > finalResidual[j] && noResReduction[j] < 5 && iterations < status[j].maxIters && timer.elapsedMilliseconds() <= status[j].maxConvergenceTime) {
+				remaining.push_back(j);
+				remainingColumns.push_back(c);
+			} else {
+				status[j].numIters = iterations;
+				for (index i = 0; i < x.numberOfRows(); ++i) {
+					x.setValue(i, j, xActive(i, c));
+				}
+			}
+		}
+
+		if (remaining.empty()) break;
+
+		if (remaining.size() < active.size()) { // continue with the remaining columns only
+			xActive = selectColumns(xActive, remainingColumns);
+			bActive = selectColumns(bActive, remainingColumns);
+			for (index i = 0; i < numActiveIterates[finest]; ++i) {
+				history[finest][i] = selectColumns(history[finest][i], remainingColumns);
+				rHistory[finest][i] = selectColumns(rHistory[finest][i], remainingColumns);
+			}
+			active = std::move(remaining);
+		}
+
+		count numPreSmoothIters = 0;
+		count numPostSmoothIters = 0;
+		for (index j : active) {
+			numPreSmoothIters = std::max(numPreSmoothIters, status[j].numPreSmoothIters);
+			numPostSmoothIters = std::max(numPostSmoothIters, status[j].numPostSmoothIters);
 		}
+
+		cycle(xActive, bActive, finest, coarsest, numVisits, X, B, numPreSmoothIters, numPostSmoothIters);
+		residual(finest, xActive, bActive, r);
+		std::vector<double> activeResiduals = columnLengths(r);
 		iterations++;
+		for (index c = 0; c < active.size(); ++c) {
+			index j = active[c];
+			residuals[j] = activeResiduals[c];
+			status[j].residualHistory.emplace_back(residuals[j]);
+			if (residuals[j] < bestResidual[j]) {
+				noResReduction[j] = 0;
+				bestResidual[j] = residuals[j];
+			} else {
+				++noResReduction[j];
+			}
+		}
 	}
 
 	timer.stop();
 
-	status.numIters = iterations;
-	status.residual = r.length();
-	status.converged = r.length() <= finalResidual;
+	for (index j = 0; j < k; ++j) {
+		status[j].residual = residuals[j];
+		status[j].converged = residuals[j] <= finalResidual[j];
+	}
 }
 
 template<class Matrix>
-void SolverLamg<Matrix>::cycle(Vector& x, const Vector& b, int finest, int coarsest, std::vector<count>& numVisits, std::vector<Vector>& X, std::vector<Vector>& B, const LAMGSolverStatus& status) {
+void SolverLamg<Matrix>::cycle(DenseMatrix& x, const DenseMatrix& b, int finest, int coarsest, std::vector<count>& numVisits, std::vector<DenseMatrix>& X, std::vector<DenseMatrix>& B, count numPreSmoothIters, count numPostSmoothIters) {
+	const count k = b.numberOfColumns();
 	std::fill(numVisits.begin(), numVisits.end(), 0);
 	X[finest] = x;
 	B[finest] = b;
@@ -179,22 +267,28 @@ void SolverLamg<Matrix>::cycle(Vector& x, const Vector& b, int finest, int coars
 	int currLvl = finest;
 	int nextLvl = finest;
 	double maxVisits = 0.0;
+	DenseMatrix r;
 
-	saveIterate(currLvl, X[currLvl], B[currLvl] - hierarchy.at(currLvl).getLaplacian() * X[currLvl]);
+	residual(currLvl, X[currLvl], B[currLvl], r);
+	saveIterate(currLvl, X[currLvl], r);
 	while (true) {
 		if (currLvl == coarsest) {
 			nextLvl = currLvl - 1;
 			if (currLvl == finest) { // finest level
-				X[currLvl] = smoother.relax(hierarchy.at(currLvl).getLaplacian(), B[currLvl], X[currLvl], status.numPreSmoothIters);
+				smoother.relaxBlock(hierarchy.at(currLvl).getLaplacian(), B[currLvl], X[currLvl], numPreSmoothIters);
 			} else {
-				Vector bCoarse(B[currLvl].getDimension()+1, 0.0);
-				for (index i = 0; i < B[currLvl].getDimension(); ++i) {
-					bCoarse[i] = B[currLvl][i];
+				DenseMatrix bCoarse(B[currLvl].numberOfRows()+1, k);
+				for (index i = 0; i < B[currLvl].numberOfRows(); ++i) {
+					for (index j = 0; j < k; ++j) {
+						bCoarse.setValue(i, j, B[currLvl](i, j));
+					}
 				}
 
-				Vector xCoarse = DenseMatrix::LUSolve(hierarchy.getCoarseMatrix(), bCoarse);
-				for (index i = 0; i < X[currLvl].getDimension(); ++i) {
-					X[currLvl][i] = xCoarse[i];
+				DenseMatrix xCoarse = DenseMatrix::LUSolve(hierarchy.getCoarseMatrix(), bCoarse);
+				for (index i = 0; i < X[currLvl].numberOfRows(); ++i) {
+					for (index j = 0; j < k; ++j) {
+						X[currLvl].setValue(i, j, xCoarse(i, j));
+					}
 				}
 			}
 		} else {
@@ -217,13 +311,14 @@ void SolverLamg<Matrix>::cycle(Vector& x, const Vector& b, int finest, int coars
 			numVisits[currLvl]++;
 
 			if (hierarchy.getType(nextLvl) != ELIMINATION) {
-				X[currLvl] = smoother.relax(hierarchy.at(currLvl).getLaplacian(), B[currLvl], X[currLvl], status.numPreSmoothIters);
+				smoother.relaxBlock(hierarchy.at(currLvl).getLaplacian(), B[currLvl], X[currLvl], numPreSmoothIters);
 			}
 
 			if (hierarchy.getType(nextLvl) == ELIMINATION) {
 				hierarchy.at(nextLvl).restrict(B[currLvl], B[nextLvl], bStages[nextLvl]);
 			} else {
-				hierarchy.at(nextLvl).restrict(B[currLvl] - hierarchy.at(currLvl).getLaplacian() * X[currLvl], B[nextLvl]);
+				residual(currLvl, X[currLvl], B[currLvl], r);
+				hierarchy.at(nextLvl).restrict(r, B[nextLvl]);
 			}
 
 			hierarchy.at(nextLvl).coarseType(X[currLvl], X[nextLvl]);
@@ -231,23 +326,25 @@ void SolverLamg<Matrix>::cycle(Vector& x, const Vector& b, int finest, int coars
 			clearHistory(nextLvl);
 		} else { // postProcess
 			if (currLvl == coarsest || hierarchy.getType(currLvl+1) != ELIMINATION) {
-				minRes(currLvl, X[currLvl], B[currLvl] - hierarchy.at(currLvl).getLaplacian() * X[currLvl]);
+				residual(currLvl, X[currLvl], B[currLvl], r);
+				minRes(currLvl, X[currLvl], r);
 			}
 
 			if (nextLvl > finest) {
-				saveIterate(nextLvl, X[nextLvl], B[nextLvl] - hierarchy.at(nextLvl).getLaplacian() * X[nextLvl]);
+				residual(nextLvl, X[nextLvl], B[nextLvl], r);
+				saveIterate(nextLvl, X[nextLvl], r);
 			}
 
 			if (hierarchy.getType(currLvl) == ELIMINATION) {
 				hierarchy.at(currLvl).interpolate(X[currLvl], X[nextLvl], bStages[currLvl]);
 			} else {
-				Vector xf = X[nextLvl];
+				DenseMatrix xf;
 				hierarchy.at(currLvl).interpolate(X[currLvl], xf);
 				X[nextLvl] += xf;
 			}
 
 			if (hierarchy.getType(currLvl) != ELIMINATION) {
-				X[nextLvl] = smoother.relax(hierarchy.at(nextLvl).getLaplacian(), B[nextLvl], X[nextLvl], status.numPostSmoothIters);
+				smoother.relaxBlock(hierarchy.at(nextLvl).getLaplacian(), B[nextLvl], X[nextLvl], numPostSmoothIters);
 			}
 
 		}
@@ -257,16 +354,53 @@ void SolverLamg<Matrix>::cycle(Vector& x, const Vector& b, int finest, int coars
 
 	// post-cycle finest
 	if ((int64_t) hierarchy.size() > finest + 1 && hierarchy.getType(finest+1) != ELIMINATION) { // do an iterate recombination on calculated solutions
-		minRes(finest, X[finest], B[finest] - hierarchy.at(finest).getLaplacian() * X[finest]);
+		residual(finest, X[finest], B[finest], r);
+		minRes(finest, X[finest], r);
 	}
 
+	std::vector<double> mean(k, 0.0);
+	for (index i = 0; i < X[finest].numberOfRows(); ++i) {
+		for (index j = 0; j < k; ++j) {
+			mean[j] += X[finest](i, j);
+		}
+	}
+	for (index j = 0; j < k; ++j) {
+		mean[j] /= X[finest].numberOfRows();
+	}
 
-	X[finest] -= X[finest].mean();
+#pragma omp parallel for
+	for (index i = 0; i < X[finest].numberOfRows(); ++i) {
+		for (index j = 0; j < k; ++j) {
+			X[finest].setValue(i, j, X[finest](i, j) - mean[j]);
+		}
+	}
 	x = X[finest];
 }
 
 template<class Matrix>
-void SolverLamg<Matrix>::saveIterate(index level, const Vector& x, const Vector& r) {
+void SolverLamg<Matrix>::residual(index level, const DenseMatrix& x, const DenseMatrix& b, DenseMatrix& r) const {
+	const Matrix& A = hierarchy.at(level).getLaplacian();
+	const count k = b.numberOfColumns();
+	if (r.numberOfRows() != A.numberOfRows() || r.numberOfColumns() != k) {
+		r = DenseMatrix(A.numberOfRows(), k);
+	}
+
+	// one pass over the matrix for all right-hand sides
+#pragma omp parallel for
+	for (index i = 0; i < A.numberOfRows(); ++i) {
+		for (index j = 0; j < k; ++j) {
+			r.setValue(i, j, b(i, j));
+		}
+		A.forNonZeroElementsInRow(i, [&](index column, double value) {
+			for (index j = 0; j < k; ++j) {
+				r.setValue(i, j, r(i, j) - value * x(column, j));
+			}
+		});
+	}
+}
+
+template<class Matrix>
+void SolverLamg<Matrix>::saveIterate(index level, const DenseMatrix& x, const DenseMatrix& r) {
 	// update latest pointer
 	index i = latestIterate[level];
 	latestIterate[level] = (i+1) % MAX_COMBINED_ITERATES;
@@ -289,50 +423,60 @@ void SolverLamg<Matrix>::clearHistory(index level) {
 }
 
 template<class Matrix>
-void SolverLamg<Matrix>::minRes(index level, Vector& x, const Vector& r) {
+void SolverLamg<Matrix>::minRes(index level, DenseMatrix& x, const DenseMatrix& r) {
+	for (index j = 0; j < x.numberOfColumns(); ++j) {
+		minRes(level, j, x, r);
+	}
+}
+
+template<class Matrix>
+void SolverLamg<Matrix>::minRes(index level, index column, DenseMatrix& x, const DenseMatrix& r) {
 	if (numActiveIterates[level] > 0) {
 		count n = numActiveIterates[level];
+		count dimension = r.numberOfRows();
+		const std::vector<DenseMatrix>& iterates = history[level];
+		const std::vector<DenseMatrix>& rIterates = rHistory[level];
 
-		std::vector<index> ARowIdx(r.getDimension()+1);
-		std::vector<index> ERowIdx(r.getDimension()+1);
+		std::vector<index> ARowIdx(dimension+1);
+		std::vector<index> ERowIdx(dimension+1);
 
 #pragma omp parallel for
-		for (index i = 0; i < r.getDimension(); ++i) {
+		for (index i = 0; i < dimension; ++i) {
 			for (index k = 0; k < n; ++k) {
-				double AEvalue = r[i] - rHistory[level][k][i];
+				double AEvalue = r(i, column) - rIterates[k](i, column);
 				if (std::fabs(AEvalue) > 1e-25) {
 					++ARowIdx[i+1];
 				}
 
-				double Eval = history[level][k][i] - x[i];
+				double Eval = iterates[k](i, column) - x(i, column);
 				if (std::fabs(Eval) > 1e-25) {
 					++ERowIdx[i+1];
 				}
 			}
 		}
 
-		for (index i = 0; i < r.getDimension(); ++i) {
+		for (index i = 0; i < dimension; ++i) {
 			ARowIdx[i+1] += ARowIdx[i];
 			ERowIdx[i+1] += ERowIdx[i];
 		}
 
-		std::vector<index> AColumnIdx(ARowIdx[r.getDimension()]);
-		std::vector<double> ANonZeros(ARowIdx[r.getDimension()]);
+		std::vector<index> AColumnIdx(ARowIdx[dimension]);
+		std::vector<double> ANonZeros(ARowIdx[dimension]);
 
-		std::vector<index> EColumnIdx(ERowIdx[r.getDimension()]);
-		std::vector<double> ENonZeros(ERowIdx[r.getDimension()]);
+		std::vector<index> EColumnIdx(ERowIdx[dimension]);
+		std::vector<double> ENonZeros(ERowIdx[dimension]);
 
 #pragma omp parallel for
-		for (index i = 0; i < r.getDimension(); ++i) {
+		for (index i = 0; i < dimension; ++i) {
 			for (index k = 0, aIdx = ARowIdx[i], eIdx = ERowIdx[i]; k < n; ++k) {
-				double AEvalue = r[i] - rHistory[level][k][i];
+				double AEvalue = r(i, column) - rIterates[k](i, column);
 				if (std::fabs(AEvalue) > 1e-25) {
 					AColumnIdx[aIdx] = k;
 					ANonZeros[aIdx] = AEvalue;
 					++aIdx;
 				}
 
-				double Eval = history[level][k][i] - x[i];
+				double Eval = iterates[k](i, column) - x(i, column);
 				if (std::fabs(Eval) > 1e-25) {
 					EColumnIdx[eIdx] = k;
 					ENonZeros[eIdx] = Eval;
@@ -341,13 +485,45 @@ void SolverLamg<Matrix>::minRes(index level, Vector& x, const Vector& r) {
 			}
 		}
 
-		CSRMatrix AE(r.getDimension(), n, ARowIdx, AColumnIdx, ANonZeros, 0.0, true);
-		CSRMatrix E(r.getDimension(), n, ERowIdx, EColumnIdx, ENonZeros, 0.0, true);
+		CSRMatrix AE(dimension, n, ARowIdx, AColumnIdx, ANonZeros, 0.0, true);
+		CSRMatrix E(dimension, n, ERowIdx, EColumnIdx, ENonZeros, 0.0, true);
+
+		Vector rColumn = r.column(column);
+		Vector alpha = smoother.relax(CSRMatrix::mTmMultiply(AE, AE), CSRMatrix::mTvMultiply(AE, rColumn), Vector(n, 0.0), 10);
+		Vector correction = E * alpha;
+#pragma omp parallel for
+		for (index i = 0; i < dimension; ++i) {
+			x.setValue(i, column, x(i, column) + correction[i]);
+		}
+	}
+
+}
+
+template<class Matrix>
+std::vector<double> SolverLamg<Matrix>::columnLengths(const DenseMatrix& matrix) {
+	std::vector<double> lengths(matrix.numberOfColumns(), 0.0);
+	for (index i = 0; i < matrix.numberOfRows(); ++i) {
+		for (index j = 0; j < matrix.numberOfColumns(); ++j) {
+			lengths[j] += matrix(i, j) * matrix(i, j);
+		}
+	}
 
-		Vector alpha = smoother.relax(CSRMatrix::mTmMultiply(AE, AE), CSRMatrix::mTvMultiply(AE, r), Vector(n, 0.0), 10);
-		x += E * alpha;
+	for (double& length : lengths) {
+		length = std::sqrt(length);
 	}
+	return lengths;
+}
 
+template<class Matrix>
+DenseMatrix SolverLamg<Matrix>::selectColumns(const DenseMatrix& matrix, const std::vector<index>& columns) {
+	DenseMatrix result(matrix.numberOfRows(), columns.size());
+#pragma omp parallel for
+	for (index i = 0; i < matrix.numberOfRows(); ++i) {
+		for (index j = 0; j < columns.size(); ++j) {
+			result.setValue(i, j, matrix(i, columns[j]));
+		}
+	}
+	return result;
 }
 
 } /* namespace NetworKit */
@@ -0,0 +1,210 @@
+/*
+ * ParallelGaussSeidelRelaxation.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef PARALLELGAUSSSEIDELRELAXATION_H_
+#define PARALLELGAUSSSEIDELRELAXATION_H_
+
+#include "Smoother.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace NetworKit {
+
+/**
+ * @ingroup numerics
+ * Implementation of a hybrid Gauss-Seidel smoother that relaxes contiguous blocks of rows in parallel. Within a block
+ * the rows are relaxed like in GaussSeidelRelaxation, entries of other blocks are taken from the previous iterate
+ * (Jacobi-style). The blocks depend only on the dimension of the matrix, not on the number of threads, so the results
+ * are reproducible. Matrices with fewer than minParallelRows rows form a single block, which is the same as
+ * GaussSeidelRelaxation.
+ */
+template<class Matrix>
+class ParallelGaussSeidelRelaxation : public Smoother<Matrix> {
+
+private:
+	double tolerance;
+
+	/** matrices with fewer rows are relaxed sequentially */
+	static constexpr count minParallelRows = 1024;
+
+	/** number of blocks of larger matrices */
+	static constexpr count numberOfBlocks = 64;
+
+public:
+	/**
+	 * Constructs a parallel Gauss-Seidel smoother with the given @a tolerance (default: 1e-15).
+	 * @param tolerance
+	 */
+	ParallelGaussSeidelRelaxation(double tolerance=1e-15) : tolerance(tolerance) {}
+
+	/**
+	 * Utilizes parallel Gauss-Seidel relaxations until the given number of @a maxIterations is reached or the relative
+	 * residual is below the tolerance specified in the constructor. The solver starts with @a initialGuess as intitial
+	 * guess to the solution.
+	 * @param A The matrix.
+	 * @param b The right-hand-side.
+	 * @param initialGuess
+	 * @param maxIterations
+	 * @return The (approximate) solution to the system.
+	 */
+	Vector relax(const Matrix& A, const Vector& b, const Vector& initialGuess, const count maxIterations = std::numeric_limits<count>::max()) const;
+
+	/**
+	 * Utilizes parallel Gauss-Seidel relaxations until the given number of @a maxIterations is reached or the relative
+	 * residual is below the tolerance specified in the constructor.
+	 * @param A The matrix.
+	 * @param b The right-hand-side.
+	 * @param maxIterations
+	 * @return The (approximate) solution to the system.
+	 */
+	Vector relax(const Matrix& A, const Vector& b, const count maxIterations = std::numeric_limits<count>::max()) const;
+
+	/**
+	 * Utilizes parallel Gauss-Seidel relaxations on the systems A*X = B for all columns of the n x k block @a B at once.
+	 * The blocks of rows are relaxed in parallel like in relax, every row of @a A is read once per sweep for all columns.
+	 * A column stops being relaxed once the relative residual of its new iterate is below the tolerance, the same test
+	 * as in relax. The relaxation stops when @a maxIterations is reached or all columns stopped.
+	 * @param A The matrix.
+	 * @param B The right-hand sides as columns.
+	 * @param X[out] The initial guesses and relaxed solutions as columns.
+	 * @param maxIterations
+	 */
+	void relaxBlock(const Matrix& A, const DenseMatrix& B, DenseMatrix& X, const count maxIterations = std::numeric_limits<count>::max()) const override;
+
+};
+
+template<class Matrix>
+Vector ParallelGaussSeidelRelaxation<Matrix>::relax(const Matrix& A, const Vector& b, const Vector& initialGuess, const count maxIterations) const {
+	count iterations = 0;
+	Vector x_old = initialGuess;
+	Vector x_new = initialGuess;
+	if (maxIterations == 0) return initialGuess;
+
+	count dimension = A.numberOfColumns();
+	Vector diagonal = A.diagonal();
+	count numBlocks = dimension >= minParallelRows ? numberOfBlocks : 1;
+	count blockSize = (dimension + numBlocks - 1) / numBlocks;
+
+	do {
+		x_old = x_new;
+
+#pragma omp parallel for schedule(dynamic, 1) if (numBlocks > 1)
+		for (index block = 0; block < numBlocks; ++block) {
+			index begin = std::min(dimension, block * blockSize);
+			index end = std::min(dimension, begin + blockSize);
+
+			for (index i = begin; i < end; ++i) {
+				double sigma = 0.0;
+				A.forNonZeroElementsInRow(i, [&](index column, double value) {
+					if (column != i) {
+						bool inBlock = column >= begin && column < end;
+						sigma += value * (inBlock ? x_new[column] : x_old[column]);
+					}
+				});
+
+				x_new[i] = (b[i] - sigma) / diagonal[i];
+			}
+		}
+
+		iterations++;
+	} while (iterations < maxIterations && (A*x_new - b).length() / b.length() > tolerance);
+
+	return x_new;
+}
+
+template<class Matrix>
+Vector ParallelGaussSeidelRelaxation<Matrix>::relax(const Matrix& A, const Vector& b, const count maxIterations) const {
+	Vector x(b.getDimension());
+	return relax(A, b, x, maxIterations);
+}
+
+template<class Matrix>
+void ParallelGaussSeidelRelaxation<Matrix>::relaxBlock(const Matrix& A, const DenseMatrix& B, DenseMatrix& X, const count maxIterations) const {
+	const count k = B.numberOfColumns();
+	count dimension = A.numberOfColumns();
+	Vector diagonal = A.diagonal();
+	count numBlocks = dimension >= minParallelRows ? numberOfBlocks : 1;
+	count blockSize = (dimension + numBlocks - 1) / numBlocks;
+
+	std::vector<double> bNorm(k, 0.0); // squared norms of the right-hand sides
+	for (index i = 0; i < dimension; ++i) {
+		for (index j = 0; j < k; ++j) {
+			bNorm[j] += B(i,j) * B(i,j);
+		}
+	}
+
+	std::vector<index> active(k);
+	std::iota(active.begin(), active.end(), 0);
+	// squared residual norms per block, summed up in block order to keep the results reproducible
+	std::vector<std::vector<double>> blockNorm(numBlocks, std::vector<double>(k));
+	DenseMatrix X_old;
+
+	for (count iterations = 0; iterations < maxIterations && !active.empty(); ++iterations) {
+		X_old = X;
+
+#pragma omp parallel for schedule(dynamic, 1) if (numBlocks > 1)
+		for (index block = 0; block < numBlocks; ++block) {
+			index begin = std::min(dimension, block * blockSize);
+			index end = std::min(dimension, begin + blockSize);
+			std::vector<double> r(k);
+
+			for (index i = begin; i < end; ++i) {
+				for (index j : active) {
+					r[j] = B(i,j);
+				}
+				A.forNonZeroElementsInRow(i, [&](index column, double value) {
+					const DenseMatrix& source = column >= begin && column < end ? X : X_old;
+					for (index j : active) {
+						r[j] -= value * source(column, j);
+					}
+				});
+
+				for (index j : active) {
+					X.setValue(i, j, X(i,j) + r[j] / diagonal[i]);
+				}
+			}
+		}
+
+		// residual B - A*X of the new iterate, as in relax
+#pragma omp parallel for schedule(dynamic, 1) if (numBlocks > 1)
+		for (index block = 0; block < numBlocks; ++block) {
+			index begin = std::min(dimension, block * blockSize);
+			index end = std::min(dimension, begin + blockSize);
+			std::vector<double>& rNorm = blockNorm[block];
+			std::fill(rNorm.begin(), rNorm.end(), 0.0);
+			std::vector<double> r(k);
+
+			for (index i = begin; i < end; ++i) {
+				for (index j : active) {
+					r[j] = B(i,j);
+				}
+				A.forNonZeroElementsInRow(i, [&](index column, double value) {
+					for (index j : active) {
+						r[j] -= value * X(column, j);
+					}
+				});
+
+				for (index j : active) {
+					rNorm[j] += r[j] * r[j];
+				}
+			}
+		}
+
+		active.erase(std::remove_if(active.begin(), active.end(), [&](index j) {
+			double rNorm = 0.0;
+			for (index block = 0; block < numBlocks; ++block) {
+				rNorm += blockNorm[block][j];
+			}
+			return rNorm <= tolerance * tolerance * bNorm[j];
+		}), active.end());
+	}
+}
+
+} /* namespace NetworKit */
+
+#endif /* PARALLELGAUSSSEIDELRELAXATION_H_ */
@@ -9,6 +9,7 @@
 #define SMOOTHER_H_
 
 #include "../algebraic/CSRMatrix.h"
+#include "../algebraic/DenseMatrix.h"
 #include "../algebraic/Vector.h"
 
 #include <limits>
@@ -28,6 +29,23 @@ public:
 
 	virtual Vector relax(const Matrix& A, const Vector& b, const Vector& initialGuess, const count maxIterations = std::numeric_limits<count>::max()) const = 0;
 	virtual Vector relax(const Matrix& A, const Vector& b, const count maxIterations = std::numeric_limits<count>::max()) const = 0;
+
+	/**
+	 * Relaxes the systems A*X = B for all columns of the dense n x k block @a B. The columns of @a X serve as initial
+	 * guesses and are replaced by the relaxed solutions. The default implementation relaxes each column on its own.
+	 * @param A The matrix.
+	 * @param B The right-hand sides as columns.
+	 * @param X[out] The initial guesses and relaxed solutions as columns.
+	 * @param maxIterations
+	 */
+	virtual void relaxBlock(const Matrix& A, const DenseMatrix& B, DenseMatrix& X, const count maxIterations = std::numeric_limits<count>::max()) const {
+		for (index j = 0; j < B.numberOfColumns(); ++j) {
+			Vector x = relax(A, B.column(j), X.column(j), maxIterations);
+			for (index i = 0; i < x.getDimension(); ++i) {
+				X.setValue(i, j, x[i]);
+			}
+		}
+	}
 };
 
 } /* namespace NetworKit */
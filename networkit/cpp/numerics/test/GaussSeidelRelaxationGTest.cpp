@@ -7,6 +7,9 @@
 
 #include "GaussSeidelRelaxationGTest.h"
 
+#include <algorithm>
+#include <omp.h>
+
 namespace NetworKit {
 
 TEST(GaussSeidelRelaxationGTest, trySolve) {
@@ -49,4 +52,87 @@ TEST(GaussSeidelRelaxationGTest, tryIteration) {
 	EXPECT_TRUE(result[3] > 0);
 }
 
+TEST(GaussSeidelRelaxationGTest, tryParallelSolve) {
+	// diagonally dominant tridiagonal system, large enough to be relaxed in parallel blocks
+	count n = 5000;
+	std::vector<Triplet> triplets;
+	for (index i = 0; i < n; ++i) {
+		triplets.push_back({i, i, 4});
+		if (i > 0) triplets.push_back({i, i - 1, -1});
+		if (i + 1 < n) triplets.push_back({i, i + 1, -1});
+	}
+	CSRMatrix A(n, triplets);
+
+	Vector expected(n);
+	for (index i = 0; i < n; ++i) {
+		expected[i] = (i % 7) - 3.0;
+	}
+	Vector b = A * expected;
+
+	ParallelGaussSeidelRelaxation<CSRMatrix> solver(1e-12);
+	Vector result = solver.relax(A, b, Vector(n, 0.0), 1000);
+
+	for (index i = 0; i < n; ++i) {
+		EXPECT_NEAR(expected[i], result[i], 1e-9);
+	}
+
+	// the blocks do not depend on the number of threads
+	int threads = omp_get_max_threads();
+	omp_set_num_threads(1);
+	Vector sequential = solver.relax(A, b, Vector(n, 0.0), 20);
+	omp_set_num_threads(std::max(threads, 4));
+	Vector parallel = solver.relax(A, b, Vector(n, 0.0), 20);
+	omp_set_num_threads(threads);
+	for (index i = 0; i < n; ++i) {
+		EXPECT_EQ(sequential[i], parallel[i]);
+	}
+}
+
+TEST(GaussSeidelRelaxationGTest, tryRelaxBlock) {
+	count n = 5000;
+	count k = 3;
+	std::vector<Triplet> triplets;
+	for (index i = 0; i < n; ++i) {
+		triplets.push_back({i, i, 4});
+		if (i > 0) triplets.push_back({i, i - 1, -1});
+		if (i + 1 < n) triplets.push_back({i, i + 1, -1});
+	}
+	CSRMatrix A(n, triplets);
+
+	DenseMatrix B(n, k);
+	for (index i = 0; i < n; ++i) {
+		for (index j = 0; j < k; ++j) {
+			B.setValue(i, j, ((i * (j + 1)) % 11) - 5.0);
+		}
+	}
+
+	GaussSeidelRelaxation<CSRMatrix> gaussSeidel(1e-12);
+	ParallelGaussSeidelRelaxation<CSRMatrix> parallelGaussSeidel(1e-12);
+	std::vector<Smoother<CSRMatrix>*> smoothers = {&gaussSeidel, &parallelGaussSeidel};
+	for (Smoother<CSRMatrix>* smoother : smoothers) {
+		// a few sweeps give the same iterates as relaxing each column on its own
+		DenseMatrix X(n, k);
+		smoother->relaxBlock(A, B, X, 5);
+		for (index j = 0; j < k; ++j) {
+			Vector x = smoother->relax(A, B.column(j), Vector(n, 0.0), 5);
+			for (index i = 0; i < n; ++i) {
+				EXPECT_NEAR(x[i], X(i, j), 1e-12);
+			}
+		}
+
+		// every column converges to the solution of relax with the same stopping test
+		X = DenseMatrix(n, k);
+		smoother->relaxBlock(A, B, X, 1000);
+		for (index j = 0; j < k; ++j) {
+			Vector b = B.column(j);
+			Vector x = X.column(j);
+			EXPECT_LE((A * x - b).length() / b.length(), 1e-10);
+			Vector expected = smoother->relax(A, b, Vector(n, 0.0), 1000);
+			for (index i = 0; i < n; ++i) {
+				EXPECT_NEAR(expected[i], x[i], 1e-10);
+			}
+		}
+	}
+}
+
 } /* namespace NetworKit */
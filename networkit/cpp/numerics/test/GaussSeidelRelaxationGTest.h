@@ -15,6 +15,7 @@
 #include "../../algebraic/CSRMatrix.h"
 #include "../../algebraic/Vector.h"
 #include "../GaussSeidelRelaxation.h"
+#include "../ParallelGaussSeidelRelaxation.h"
 
 namespace NetworKit {
 
@@ -8,6 +8,7 @@
 #include "LAMGGTest.h"
 #include "../LAMG/MultiLevelSetup.h"
 #include "../LAMG/SolverLamg.h"
+#include "../LAMG/Lamg.h"
 #include "../../io/LineFileReader.h"
 #include "../../auxiliary/Timer.h"
 #include "../../algebraic/CSRMatrix.h"
@@ -70,6 +71,71 @@ TEST_F(LAMGGTest, testSmallGraphs) {
 
 
 
+TEST_F(LAMGGTest, testParallelSmoother) {
+	METISGraphReader reader;
+	for (LAMGSmoother smootherType : {LAMGSmoother::GAUSS_SEIDEL, LAMGSmoother::PARALLEL_GAUSS_SEIDEL}) {
+		Graph G = reader.read("input/power.graph");
+		Lamg<CSRMatrix> lamg(1e-6, smootherType);
+		lamg.setupConnected(CSRMatrix::laplacianMatrix(G));
+
+		Vector b = randZeroSum(G, 12345);
+		Vector x(G.numberOfNodes());
+		SolverStatus status = lamg.solve(b, x);
+
+		EXPECT_TRUE(status.converged);
+		EXPECT_LE((CSRMatrix::laplacianMatrix(G) * x - b).length() / b.length(), 1e-6);
+		INFO("numIters = ", status.numIters);
+	}
+}
+
+TEST_F(LAMGGTest, testSolveBlock) {
+	METISGraphReader reader;
+	Graph G = reader.read("input/power.graph");
+	CSRMatrix L = CSRMatrix::laplacianMatrix(G);
+	Lamg<CSRMatrix> lamg(1e-6);
+	lamg.setupConnected(L);
+
+	std::vector<Vector> B;
+	for (index j = 0; j < 5; ++j) {
+		B.push_back(randZeroSum(G, 12345 + j));
+	}
+	std::vector<Vector> X(B.size(), Vector(G.numberOfNodes()));
+	std::vector<SolverStatus> stati = lamg.solveBlock(B, X);
+	ASSERT_EQ(B.size(), stati.size());
+
+	for (index j = 0; j < B.size(); ++j) {
+		Vector x(G.numberOfNodes());
+		SolverStatus status = lamg.solve(B[j], x);
+
+		EXPECT_TRUE(stati[j].converged);
+		EXPECT_LE((L * X[j] - B[j]).length() / B[j].length(), 1e-6);
+		EXPECT_LE(stati[j].numIters, status.numIters + 1);
+		EXPECT_LE((X[j] - x).length() / x.length(), 1e-4);
+	}
+
+	// two copies of the graph are solved per component
+	count n = G.numberOfNodes();
+	Graph H(2 * n);
+	G.forEdges([&](node u, node v) {
+		H.addEdge(u, v);
+		H.addEdge(n + u, n + v);
+	});
+	CSRMatrix LH = CSRMatrix::laplacianMatrix(H);
+	Lamg<CSRMatrix> lamgComponents(1e-6);
+	lamgComponents.setup(LH);
+
+	B.clear();
+	for (index j = 0; j < 3; ++j) {
+		B.push_back(randZeroSum(H, 54321 + j));
+	}
+	X = std::vector<Vector>(B.size(), Vector(H.numberOfNodes()));
+	stati = lamgComponents.solveBlock(B, X);
+	for (index j = 0; j < B.size(); ++j) {
+		EXPECT_LE((LH * X[j] - B[j]).length() / B[j].length(), 1e-5);
+	}
+}
+
+
 Vector LAMGGTest::randVector(count dimension, double lower, double upper) const {
 	Vector randVector(dimension);
 	for (index i = 0; i < dimension; ++i) {
@@ -0,0 +1,40 @@
+/*
+ * ConcurrentUnionFind.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: NetworKit contributors
+ */
+
+#include "ConcurrentUnionFind.h"
+
+namespace NetworKit {
+
+ConcurrentUnionFind::ConcurrentUnionFind(index maxElement) : parent(maxElement) {
+	allToSingletons();
+}
+
+void ConcurrentUnionFind::allToSingletons() {
+#pragma omp parallel for
+	for (index i = 0; i < parent.size(); ++i) {
+		parent[i].store(i, std::memory_order_relaxed);
+	}
+}
+
+void ConcurrentUnionFind::compress() {
+#pragma omp parallel for
+	for (index i = 0; i < parent.size(); ++i) {
+		parent[i].store(find(i), std::memory_order_relaxed);
+	}
+}
+
+Partition ConcurrentUnionFind::toPartition() {
+	Partition p(parent.size());
+	p.setUpperBound(parent.size());
+#pragma omp parallel for
+	for (index e = 0; e < parent.size(); ++e) {
+		p[e] = find(e);
+	}
+	return p;
+}
+
+}
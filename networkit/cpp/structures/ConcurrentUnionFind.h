@@ -0,0 +1,108 @@
+/*
+ * ConcurrentUnionFind.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef CONCURRENTUNIONFIND_H_
+#define CONCURRENTUNIONFIND_H_
+
+#include <atomic>
+#include <utility>
+#include <vector>
+#include "../Globals.h"
+#include "../structures/Partition.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup structures
+ * Implements a Union Find data structure that may be used by several threads at the same time without locks.
+ * Sets are linked by index: the root with the larger index is attached to the one with the smaller index by a
+ * compare-and-swap, so the representative of a set is always its smallest element and every parent pointer points
+ * to a smaller element. find() shortens paths by path splitting, which only replaces parent pointers by other
+ * ancestors and is therefore safe under concurrent merges.
+ */
+class ConcurrentUnionFind {
+private:
+	std::vector<std::atomic<index>> parent;
+
+public:
+	/**
+	 * Create a new set representation with not more the @a maxElement elements.
+	 * Initially every element is in its own set.
+	 * @param maxElement maximum number of elements
+	 */
+	ConcurrentUnionFind(index maxElement);
+
+	/**
+	 * Assigns every element to a singleton set.
+	 * Set id is equal to element id.
+	 */
+	void allToSingletons();
+
+	/**
+	 * Find the representative of element @a u, which is the smallest element of its set.
+	 * @param u element
+	 * @return representative of set containing @a u
+	 */
+	index find(index u);
+
+	/**
+	 * Merge the two sets containing @a u and @a v.
+	 * @param u element u
+	 * @param v element v
+	 * @return True if the sets were different before.
+	 */
+	bool merge(index u, index v);
+
+	/**
+	 * Points every element directly to its representative. Must not run concurrently with merge().
+	 */
+	void compress();
+
+	/**
+	 * Convert the Union Find data structure to a Partition
+	 * @return Partition equivalent to the union find data structure
+	 */
+	Partition toPartition();
+};
+
+inline index ConcurrentUnionFind::find(index u) {
+	while (true) {
+		index p = parent[u].load(std::memory_order_relaxed);
+		if (p == u) {
+			return u;
+		}
+
+		// path splitting: let u point to its grandparent and continue at the former parent
+		index gp = parent[p].load(std::memory_order_relaxed);
+		if (gp != p) {
+			parent[u].compare_exchange_weak(p, gp, std::memory_order_relaxed);
+		}
+		u = p;
+	}
+}
+
+inline bool ConcurrentUnionFind::merge(index u, index v) {
+	while (true) {
+		u = find(u);
+		v = find(v);
+		if (u == v) {
+			return false;
+		}
+		if (u < v) {
+			std::swap(u, v);
+		}
+
+		// u is the root with the larger index, it is only linked if it is still a root
+		index expected = u;
+		if (parent[u].compare_exchange_strong(expected, v)) {
+			return true;
+		}
+	}
+}
+
+}
+#endif
@@ -10,6 +10,7 @@
 #include "UnionFindGTest.h"
 
 #include "../UnionFind.h"
+#include "../ConcurrentUnionFind.h"
 
 #ifndef NOGTEST
 
@@ -72,6 +73,33 @@ TEST_F(UnionFindGTest, testMergeCircular) {
 	}
 }
 
+TEST_F(UnionFindGTest, testConcurrentMerge) {
+	const count n = 100000;
+	ConcurrentUnionFind p(n);
+
+	// merge the elements of each residue class modulo 7 in parallel and in random order
+#pragma omp parallel for schedule(dynamic, 64)
+	for (index i = 0; i < n; ++i) {
+		index j = (i * 7919) % n;
+		if (j + 7 < n) {
+			p.merge(j + 7, j);
+		}
+	}
+
+	for (index i = 0; i < n; ++i) {
+		EXPECT_EQ(i % 7, p.find(i));
+	}
+
+	EXPECT_FALSE(p.merge(3, 3 + 7 * 1000));
+	EXPECT_TRUE(p.merge(3, 4));
+	EXPECT_EQ(3u, p.find(4 + 7 * 1000));
+	p.compress();
+
+	Partition partition = p.toPartition();
+	EXPECT_EQ(6u, partition.numberOfSubsets());
+	EXPECT_EQ(partition[3], partition[3 + 7 * 1000]);
+}
+
 } /* namespace NetworKit */
 
 #endif /*NOGTEST */
@@ -4,5 +4,5 @@ This module provides flow algorithms
 
 from . import graph
 
-from _NetworKit import EdmondsKarp
+from _NetworKit import EdmondsKarp, PushRelabel
 
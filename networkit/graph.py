@@ -1,2 +1,2 @@
 # extension imports
-from _NetworKit import Graph, BFS, Dijkstra, DynBFS, DynDijkstra, SpanningForest, GraphTools, RandomMaximumSpanningForest, UnionMaximumSpanningForest
+from _NetworKit import Graph, BFS, DirOptBFS, Dijkstra, DeltaStepping, DynBFS, DynDijkstra, SpanningForest, GraphTools, RandomMaximumSpanningForest, UnionMaximumSpanningForest, BoruvkaMSF